@@ -0,0 +1,243 @@
+#include "NativeAnimationDriver.h"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace reanimated {
+
+namespace {
+
+inline double getNumber(
+    jsi::Runtime &rt,
+    const jsi::Object &object,
+    const char *name) {
+  return object.getProperty(rt, name).asNumber();
+}
+
+inline bool getBool(
+    jsi::Runtime &rt,
+    const jsi::Object &object,
+    const char *name) {
+  return object.getProperty(rt, name).getBool();
+}
+
+std::array<double, 4> getNumbers4(jsi::Runtime &rt, const jsi::Array &array) {
+  if (array.size(rt) != 4) {
+    throw std::runtime_error(
+        "[Reanimated] Bezier easing needs exactly 4 control points.");
+  }
+  return {
+      array.getValueAtIndex(rt, 0).asNumber(),
+      array.getValueAtIndex(rt, 1).asNumber(),
+      array.getValueAtIndex(rt, 2).asNumber(),
+      array.getValueAtIndex(rt, 3).asNumber()};
+}
+
+TimingAnimation::Easing parseEasing(jsi::Runtime &rt, const jsi::Value &value) {
+  if (value.isString()) {
+    const auto name = value.getString(rt).utf8(rt);
+    if (name == "inOutQuad") {
+      return TimingAnimation::InOutQuad{};
+    }
+    throw std::runtime_error(
+        "[Reanimated] Unknown native easing `" + name + "`.");
+  }
+  const auto points = getNumbers4(rt, value.asObject(rt).asArray(rt));
+  return BezierEasing(points[0], points[1], points[2], points[3]);
+}
+
+NumericAnimation parseAnimation(jsi::Runtime &rt, const jsi::Object &config) {
+  const auto type = config.getProperty(rt, "type").asString(rt).utf8(rt);
+  if (type == "timing") {
+    return TimingAnimation{
+        getNumber(rt, config, "current"),
+        getNumber(rt, config, "startTime"),
+        getNumber(rt, config, "startValue"),
+        getNumber(rt, config, "toValue"),
+        getNumber(rt, config, "duration"),
+        parseEasing(rt, config.getProperty(rt, "easing"))};
+  }
+  if (type == "spring") {
+    return SpringAnimation{
+        getNumber(rt, config, "current"),
+        getNumber(rt, config, "velocity"),
+        getNumber(rt, config, "lastTimestamp"),
+        getNumber(rt, config, "startTimestamp"),
+        getNumber(rt, config, "startValue"),
+        getNumber(rt, config, "toValue"),
+        getNumber(rt, config, "zeta"),
+        getNumber(rt, config, "omega0"),
+        getNumber(rt, config, "omega1"),
+        getNumber(rt, config, "duration"),
+        getNumber(rt, config, "restDisplacementThreshold"),
+        getNumber(rt, config, "restSpeedThreshold"),
+        getBool(rt, config, "useDuration"),
+        getBool(rt, config, "configIsInvalid"),
+        getBool(rt, config, "overshootClamping")};
+  }
+  if (type == "decay") {
+    std::optional<std::array<double, 2>> clamp;
+    const auto clampValue = config.getProperty(rt, "clamp");
+    if (!clampValue.isUndefined()) {
+      const auto clampArray = clampValue.asObject(rt).asArray(rt);
+      clamp = {
+          clampArray.getValueAtIndex(rt, 0).asNumber(),
+          clampArray.getValueAtIndex(rt, 1).asNumber()};
+    }
+    const bool rubberBandEffect = getBool(rt, config, "rubberBandEffect");
+    if (rubberBandEffect && !clamp.has_value()) {
+      throw std::runtime_error(
+          "[Reanimated] You need to set `clamp` property when using `rubberBandEffect`.");
+    }
+    return DecayAnimation{
+        getNumber(rt, config, "current"),
+        getNumber(rt, config, "velocity"),
+        getNumber(rt, config, "lastTimestamp"),
+        getNumber(rt, config, "startTimestamp"),
+        getNumber(rt, config, "initialVelocity"),
+        getNumber(rt, config, "deceleration"),
+        getNumber(rt, config, "velocityFactor"),
+        getNumber(rt, config, "rubberBandFactor"),
+        clamp,
+        rubberBandEffect,
+        getBool(rt, config, "springActive")};
+  }
+  throw std::runtime_error(
+      "[Reanimated] Unknown native animation type `" + type + "`.");
+}
+
+// Writes back the fields which change while the animation is running and are
+// read by the animations started on top of it.
+struct StateWriter {
+  jsi::Runtime &rt;
+  jsi::Object &object;
+
+  void operator()(const TimingAnimation &animation) const {
+    object.setProperty(rt, "current", animation.current);
+    object.setProperty(rt, "startTime", animation.startTime);
+  }
+
+  void operator()(const SpringAnimation &animation) const {
+    object.setProperty(rt, "current", animation.current);
+    object.setProperty(rt, "velocity", animation.velocity);
+    object.setProperty(rt, "lastTimestamp", animation.lastTimestamp);
+  }
+
+  void operator()(const DecayAnimation &animation) const {
+    object.setProperty(rt, "current", animation.current);
+    object.setProperty(rt, "velocity", animation.velocity);
+    object.setProperty(rt, "lastTimestamp", animation.lastTimestamp);
+  }
+};
+
+} // namespace
+
+NativeAnimationId NativeAnimationDriver::start(
+    jsi::Runtime &rt,
+    const jsi::Value &sharedValue,
+    const jsi::Value &animation,
+    const jsi::Value &config) {
+  const auto id = nextId_++;
+  auto &animations = isRunningFrame_ ? startedDuringFrame_ : animations_;
+  animations.push_back(Entry{
+      id,
+      parseAnimation(rt, config.asObject(rt)),
+      sharedValue.asObject(rt),
+      animation.asObject(rt)});
+  return id;
+}
+
+void NativeAnimationDriver::stop(jsi::Runtime &rt, NativeAnimationId id) {
+  auto *entry = find(id);
+  if (entry == nullptr || entry->cancelled || entry->done) {
+    return;
+  }
+  entry->cancelled = true;
+  std::visit(StateWriter{rt, entry->animationObject}, entry->animation);
+}
+
+size_t NativeAnimationDriver::runFrame(jsi::Runtime &rt, double timestampMs) {
+  // Cleans up also when a listener or callback throws.
+  struct FrameScope {
+    NativeAnimationDriver &driver;
+    ~FrameScope() {
+      driver.isRunningFrame_ = false;
+      auto &animations = driver.animations_;
+      animations.erase(
+          std::remove_if(
+              animations.begin(),
+              animations.end(),
+              [](const Entry &entry) { return entry.done; }),
+          animations.end());
+      animations.insert(
+          animations.end(),
+          std::make_move_iterator(driver.startedDuringFrame_.begin()),
+          std::make_move_iterator(driver.startedDuringFrame_.end()));
+      driver.startedDuringFrame_.clear();
+    }
+  } frameScope{*this};
+  isRunningFrame_ = true;
+
+  size_t animationsRun = 0;
+  // JS can only flag the entries while we iterate, new ones go to
+  // `startedDuringFrame_`.
+  for (auto &entry : animations_) {
+    if (entry.done) {
+      continue;
+    }
+    if (entry.cancelled) {
+      finish(rt, entry, false);
+      continue;
+    }
+    const bool finished = stepAnimation(entry.animation, timestampMs);
+    ++animationsRun;
+    entry.sharedValue.setProperty(
+        rt, "_value", currentValue(entry.animation));
+    if (finished) {
+      // Also when a listener has just cancelled the animation, like in JS.
+      std::visit(StateWriter{rt, entry.animationObject}, entry.animation);
+      finish(rt, entry, true);
+    }
+  }
+  return animationsRun;
+}
+
+void NativeAnimationDriver::clear() {
+  animations_.clear();
+  startedDuringFrame_.clear();
+}
+
+NativeAnimationDriver::Entry *NativeAnimationDriver::find(
+    NativeAnimationId id) {
+  // ids grow, so both lists are sorted
+  for (auto *animations : {&animations_, &startedDuringFrame_}) {
+    auto it = std::lower_bound(
+        animations->begin(),
+        animations->end(),
+        id,
+        [](const Entry &entry, NativeAnimationId id) { return entry.id < id; });
+    if (it != animations->end() && it->id == id) {
+      return &*it;
+    }
+  }
+  return nullptr;
+}
+
+void NativeAnimationDriver::finish(
+    jsi::Runtime &rt,
+    Entry &entry,
+    bool finished) {
+  entry.done = true;
+  const auto callback = entry.animationObject.getProperty(rt, "callback");
+  if (callback.isObject()) {
+    callback.asObject(rt).asFunction(rt).call(rt, finished);
+  }
+}
+
+} // namespace reanimated
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "NumericAnimations.h"
+
+using namespace facebook;
+
+namespace reanimated {
+
+using NativeAnimationId = uint64_t;
+
+// Runs number animations of shared values started with `withTiming`,
+// `withSpring` or `withDecay`. `valueSetter` hands an animation over after
+// its first frame, from then on it's stepped here and JS is only called to
+// update the shared value (which runs its listeners) and for the completion
+// callback. When the animation finishes or gets cancelled its state is written
+// back to the JS animation object, so that an animation started on top of it
+// can pick it up as if it was run in JS.
+//
+// Everything has to be called on the UI thread.
+class NativeAnimationDriver {
+ public:
+  // `config` is the object returned by `toNativeConfig` of the animation.
+  NativeAnimationId start(
+      jsi::Runtime &rt,
+      const jsi::Value &sharedValue,
+      const jsi::Value &animation,
+      const jsi::Value &config);
+  // The completion callback is called with `false` on the next frame, as it
+  // would be in JS.
+  void stop(jsi::Runtime &rt, NativeAnimationId id);
+
+  inline bool hasRunningAnimations() const {
+    return !animations_.empty() || !startedDuringFrame_.empty();
+  }
+
+  // Steps all animations, may throw if a listener of a shared value or a
+  // callback does. Returns the number of animations that were stepped.
+  size_t runFrame(jsi::Runtime &rt, double timestampMs);
+
+  // Drops all animations, has to be called before the runtime goes away.
+  void clear();
+
+ private:
+  struct Entry {
+    NativeAnimationId id;
+    NumericAnimation animation;
+    jsi::Object sharedValue;
+    jsi::Object animationObject;
+    bool cancelled = false;
+    bool done = false;
+  };
+
+  Entry *find(NativeAnimationId id);
+  void finish(jsi::Runtime &rt, Entry &entry, bool finished);
+
+  NativeAnimationId nextId_ = 1;
+  std::vector<Entry> animations_;
+  // Animations started by the shared value listeners or callbacks, they run
+  // from the next frame on like the ones started in JS do.
+  std::vector<Entry> startedDuringFrame_;
+  bool isRunningFrame_ = false;
+};
+
+} // namespace reanimated
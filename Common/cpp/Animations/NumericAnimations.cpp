@@ -0,0 +1,270 @@
+#include "NumericAnimations.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace reanimated {
+
+namespace {
+
+constexpr int kNewtonIterations = 4;
+constexpr double kNewtonMinSlope = 0.001;
+constexpr double kSubdivisionPrecision = 0.0000001;
+constexpr int kSubdivisionMaxIterations = 10;
+
+// Frames longer than that are stepped as if they took 64ms, see `withSpring`
+// and `withDecay`.
+constexpr double kMaxDeltaTime = 64;
+
+constexpr double kDecaySlopeFactor = 0.1;
+constexpr double kDecayVelocityEps = 1;
+
+inline double A(double aA1, double aA2) {
+  return 1.0 - 3.0 * aA2 + 3.0 * aA1;
+}
+
+inline double B(double aA1, double aA2) {
+  return 3.0 * aA2 - 6.0 * aA1;
+}
+
+inline double C(double aA1) {
+  return 3.0 * aA1;
+}
+
+// Returns x(t) given t, x1, and x2, or y(t) given t, y1, and y2.
+inline double calcBezier(double aT, double aA1, double aA2) {
+  return ((A(aA1, aA2) * aT + B(aA1, aA2)) * aT + C(aA1)) * aT;
+}
+
+// Returns dx/dt given t, x1, and x2, or dy/dt given t, y1, and y2.
+inline double getSlope(double aT, double aA1, double aA2) {
+  return 3.0 * A(aA1, aA2) * aT * aT + 2.0 * B(aA1, aA2) * aT + C(aA1);
+}
+
+double binarySubdivide(double aX, double aA, double aB, double x1, double x2) {
+  double currentX;
+  double currentT;
+  int i = 0;
+  do {
+    currentT = aA + (aB - aA) / 2.0;
+    currentX = calcBezier(currentT, x1, x2) - aX;
+    if (currentX > 0.0) {
+      aB = currentT;
+    } else {
+      aA = currentT;
+    }
+  } while (std::abs(currentX) > kSubdivisionPrecision &&
+           ++i < kSubdivisionMaxIterations);
+  return currentT;
+}
+
+double newtonRaphsonIterate(double aX, double aGuessT, double x1, double x2) {
+  for (int i = 0; i < kNewtonIterations; ++i) {
+    const double currentSlope = getSlope(aGuessT, x1, x2);
+    if (currentSlope == 0.0) {
+      return aGuessT;
+    }
+    const double currentX = calcBezier(aGuessT, x1, x2) - aX;
+    aGuessT -= currentX / currentSlope;
+  }
+  return aGuessT;
+}
+
+struct EasingVisitor {
+  double t;
+
+  double operator()(const TimingAnimation::InOutQuad &) const {
+    if (t < 0.5) {
+      return (t * 2) * (t * 2) / 2;
+    }
+    return 1 - ((1 - t) * 2) * ((1 - t) * 2) / 2;
+  }
+
+  double operator()(const BezierEasing &bezier) const {
+    return bezier(t);
+  }
+};
+
+} // namespace
+
+BezierEasing::BezierEasing(double x1, double y1, double x2, double y2)
+    : x1_(x1), y1_(y1), x2_(x2), y2_(y2) {
+  const double sampleStepSize = 1.0 / (kSplineTableSize - 1.0);
+  for (int i = 0; i < kSplineTableSize; ++i) {
+    sampleValues_[i] = calcBezier(i * sampleStepSize, x1_, x2_);
+  }
+}
+
+double BezierEasing::getTForX(double x) const {
+  const double sampleStepSize = 1.0 / (kSplineTableSize - 1.0);
+  double intervalStart = 0.0;
+  int currentSample = 1;
+  constexpr int lastSample = kSplineTableSize - 1;
+
+  for (; currentSample != lastSample && sampleValues_[currentSample] <= x;
+       ++currentSample) {
+    intervalStart += sampleStepSize;
+  }
+  --currentSample;
+
+  // Interpolate to provide an initial guess for t
+  const double dist = (x - sampleValues_[currentSample]) /
+      (sampleValues_[currentSample + 1] - sampleValues_[currentSample]);
+  const double guessForT = intervalStart + dist * sampleStepSize;
+
+  const double initialSlope = getSlope(guessForT, x1_, x2_);
+  if (initialSlope >= kNewtonMinSlope) {
+    return newtonRaphsonIterate(x, guessForT, x1_, x2_);
+  } else if (initialSlope == 0.0) {
+    return guessForT;
+  }
+  return binarySubdivide(
+      x, intervalStart, intervalStart + sampleStepSize, x1_, x2_);
+}
+
+double BezierEasing::operator()(double x) const {
+  if (x1_ == y1_ && x2_ == y2_) {
+    return x; // linear
+  }
+  // guarantee the extremes are right
+  if (x == 0) {
+    return 0;
+  }
+  if (x == 1) {
+    return 1;
+  }
+  return calcBezier(getTForX(x), y1_, y2_);
+}
+
+bool TimingAnimation::step(double now) {
+  const double runtime = now - startTime;
+
+  if (runtime >= duration) {
+    // reset startTime to avoid reusing finished animation config in `start`
+    startTime = 0;
+    current = toValue;
+    return true;
+  }
+  const double progress = std::visit(EasingVisitor{runtime / duration}, easing);
+  current = startValue + (toValue - startValue) * progress;
+  return false;
+}
+
+bool SpringAnimation::step(double now) {
+  const double timeFromStart = now - startTimestamp;
+
+  if (useDuration && timeFromStart >= duration) {
+    current = toValue;
+    // clear lastTimestamp to avoid using stale value by the next spring
+    // animation that starts after this one
+    lastTimestamp = 0;
+    return true;
+  }
+
+  if (configIsInvalid) {
+    // We don't animate wrong config
+    if (useDuration) {
+      return false;
+    }
+    current = toValue;
+    lastTimestamp = 0;
+    return true;
+  }
+
+  const double deltaTime = std::min(now - lastTimestamp, kMaxDeltaTime);
+  lastTimestamp = now;
+
+  const double t = deltaTime / 1000;
+  const double v0 = -velocity;
+  const double x0 = toValue - current;
+
+  double newPosition;
+  double newVelocity;
+  if (zeta < 1) {
+    const double sin1 = std::sin(omega1 * t);
+    const double cos1 = std::cos(omega1 * t);
+
+    const double envelope = std::exp(-zeta * omega0 * t);
+    const double frag1 = envelope *
+        (sin1 * ((v0 + zeta * omega0 * x0) / omega1) + x0 * cos1);
+
+    newPosition = toValue - frag1;
+    // the derivative of the oscillation function
+    newVelocity = zeta * omega0 * frag1 -
+        envelope * (cos1 * (v0 + zeta * omega0 * x0) - omega1 * x0 * sin1);
+  } else {
+    const double envelope = std::exp(-omega0 * t);
+    newPosition = toValue - envelope * (x0 + (v0 + omega0 * x0) * t);
+    newVelocity =
+        envelope * (v0 * (t * omega0 - 1) + t * x0 * omega0 * omega0);
+  }
+
+  current = newPosition;
+  velocity = newVelocity;
+
+  const bool isOvershooting = overshootClamping &&
+      ((current > toValue && startValue < toValue) ||
+       (current < toValue && startValue > toValue));
+  const bool isVelocity = std::abs(velocity) < restSpeedThreshold;
+  const bool isDisplacement =
+      std::abs(toValue - current) < restDisplacementThreshold;
+
+  if (!useDuration && (isOvershooting || (isVelocity && isDisplacement))) {
+    velocity = 0;
+    current = toValue;
+    lastTimestamp = 0;
+    return true;
+  }
+
+  return false;
+}
+
+bool DecayAnimation::step(double now) {
+  const double deltaTime = std::min(now - lastTimestamp, kMaxDeltaTime);
+  const double decayFactor = std::exp(
+      -(1 - deceleration) * (now - startTimestamp) * kDecaySlopeFactor);
+
+  if (rubberBandEffect) {
+    const auto &bounds = *clamp;
+    const int clampIndex =
+        std::abs(current - bounds[0]) < std::abs(current - bounds[1]) ? 0 : 1;
+
+    double derivative = 0;
+    if (current < bounds[0] || current > bounds[1]) {
+      derivative = current - bounds[clampIndex];
+    }
+
+    if (derivative != 0) {
+      springActive = true;
+    } else if (springActive) {
+      current = bounds[clampIndex];
+      return true;
+    }
+
+    const double v = velocity * decayFactor - derivative * rubberBandFactor;
+    current = current + (v * velocityFactor * deltaTime) / 1000;
+    velocity = v;
+    lastTimestamp = now;
+    return false;
+  }
+
+  const double v = velocity * decayFactor;
+  current = current + (v * velocityFactor * deltaTime) / 1000;
+  velocity = v;
+  lastTimestamp = now;
+
+  if (clamp.has_value()) {
+    const auto &bounds = *clamp;
+    if (initialVelocity < 0 && current <= bounds[0]) {
+      current = bounds[0];
+      return true;
+    } else if (initialVelocity > 0 && current >= bounds[1]) {
+      current = bounds[1];
+      return true;
+    }
+  }
+
+  return std::abs(v) < kDecayVelocityEps;
+}
+
+} // namespace reanimated
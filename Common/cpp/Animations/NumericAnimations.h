@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <variant>
+
+namespace reanimated {
+
+// Ports of the `withTiming`, `withSpring` and `withDecay` frame functions
+// (src/reanimated2/animation) for animations of a single number. The fields
+// mirror the ones of the JS animation objects and `step` returns true when the
+// animation is finished, exactly like `onFrame` does, so an animation started
+// in JS can be continued here and handed back at any frame.
+
+// Cubic bezier easing, same approximation as src/reanimated2/Bezier.ts.
+class BezierEasing {
+ public:
+  BezierEasing(double x1, double y1, double x2, double y2);
+
+  double operator()(double x) const;
+
+ private:
+  static constexpr int kSplineTableSize = 11;
+
+  double getTForX(double x) const;
+
+  double x1_, y1_, x2_, y2_;
+  std::array<double, kSplineTableSize> sampleValues_;
+};
+
+struct TimingAnimation {
+  // `Easing.inOut(Easing.quad)`, the default easing of `withTiming`.
+  struct InOutQuad {};
+  using Easing = std::variant<InOutQuad, BezierEasing>;
+
+  double current;
+  double startTime;
+  double startValue;
+  double toValue;
+  double duration;
+  Easing easing;
+
+  bool step(double now);
+};
+
+struct SpringAnimation {
+  double current;
+  double velocity;
+  double lastTimestamp;
+  double startTimestamp;
+  double startValue;
+  double toValue;
+  double zeta;
+  double omega0;
+  double omega1;
+  double duration;
+  double restDisplacementThreshold;
+  double restSpeedThreshold;
+  bool useDuration;
+  bool configIsInvalid;
+  bool overshootClamping;
+
+  bool step(double now);
+};
+
+struct DecayAnimation {
+  double current;
+  double velocity;
+  double lastTimestamp;
+  double startTimestamp;
+  double initialVelocity;
+  double deceleration;
+  double velocityFactor;
+  double rubberBandFactor;
+  std::optional<std::array<double, 2>> clamp;
+  bool rubberBandEffect;
+  bool springActive;
+
+  bool step(double now);
+};
+
+using NumericAnimation =
+    std::variant<TimingAnimation, SpringAnimation, DecayAnimation>;
+
+inline bool stepAnimation(NumericAnimation &animation, double now) {
+  return std::visit([now](auto &anim) { return anim.step(now); }, animation);
+}
+
+inline double currentValue(const NumericAnimation &animation) {
+  return std::visit([](const auto &anim) { return anim.current; }, animation);
+}
+
+} // namespace reanimated
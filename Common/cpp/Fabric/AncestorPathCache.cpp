@@ -0,0 +1,65 @@
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include "AncestorPathCache.h"
+
+namespace reanimated {
+
+ShadowNodeFamily::AncestorList AncestorPathCache::getAncestors(
+    const ShadowNodeFamily &family,
+    const ShadowNode &rootNode) {
+  const auto tag = family.getTag();
+  auto it = paths_.find(tag);
+  if (it != paths_.end()) {
+    ShadowNodeFamily::AncestorList ancestors;
+    if (followPath(it->second, family, rootNode, ancestors)) {
+      ++hits_;
+      return ancestors;
+    }
+  }
+  ++misses_;
+
+  auto ancestors = family.getAncestors(rootNode);
+  if (ancestors.empty()) {
+    // not in the tree (anymore)
+    if (it != paths_.end()) {
+      paths_.erase(it);
+    }
+    return ancestors;
+  }
+
+  if (it == paths_.end()) {
+    if (paths_.size() >= kMaxSize) {
+      paths_.clear();
+    }
+    it = paths_.try_emplace(tag).first;
+  }
+  auto &path = it->second;
+  path.clear();
+  for (const auto &ancestor : ancestors) {
+    path.push_back(ancestor.second);
+  }
+  return ancestors;
+}
+
+bool AncestorPathCache::followPath(
+    const std::vector<int> &path,
+    const ShadowNodeFamily &family,
+    const ShadowNode &rootNode,
+    ShadowNodeFamily::AncestorList &ancestors) {
+  const ShadowNode *node = &rootNode;
+  for (const auto childIndex : path) {
+    const auto &children = node->getChildren();
+    if (static_cast<size_t>(childIndex) >= children.size()) {
+      return false;
+    }
+    ancestors.emplace_back(*node, childIndex);
+    node = children[childIndex].get();
+  }
+  // The families are compared, not the tags, so a path can't lead to a node
+  // which reuses the tag of an unmounted view.
+  return &node->getFamily() == &family;
+}
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
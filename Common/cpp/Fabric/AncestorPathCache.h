@@ -0,0 +1,67 @@
+#pragma once
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeFamily.h>
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace facebook;
+using namespace react;
+
+namespace reanimated {
+
+// Remembers where in the tree the animated views are, as the child indices on
+// the path from the root, so that `ShadowNodeFamily::getAncestors` doesn't
+// have to search the tree for them on every frame.
+//
+// A remembered path is used only if following it from the current root leads
+// to the node of the family, which takes a single child lookup per level.
+// Otherwise, e.g. when a sibling was inserted before the view, the path is
+// searched again.
+//
+// `getAncestors` and `remove` aren't thread safe, the stats can be read from
+// any thread.
+class AncestorPathCache {
+ public:
+  struct Stats {
+    // paths which led to the node
+    uint64_t hits;
+    // paths which had to be searched
+    uint64_t misses;
+  };
+
+  ShadowNodeFamily::AncestorList getAncestors(
+      const ShadowNodeFamily &family,
+      const ShadowNode &rootNode);
+
+  void remove(Tag tag) {
+    paths_.erase(tag);
+  }
+
+  Stats getStats() const {
+    return {hits_, misses_};
+  }
+
+ private:
+  // Paths of views that were unmounted without `remove` being called are
+  // dropped all at once when there are too many.
+  static constexpr size_t kMaxSize = 4096;
+
+  static bool followPath(
+      const std::vector<int> &path,
+      const ShadowNodeFamily &family,
+      const ShadowNode &rootNode,
+      ShadowNodeFamily::AncestorList &ancestors);
+
+  std::unordered_map<Tag, std::vector<int>> paths_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+};
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
@@ -15,6 +15,12 @@ const ContextContainer &getContextContainerFromUIManager(
               ->contextContainer_;
 }
 
+const BackgroundExecutor &getBackgroundExecutorFromUIManager(
+    const UIManager &uiManager) {
+  return reinterpret_cast<const UIManagerPublic *>(&uiManager)
+      ->backgroundExecutor_;
+}
+
 } // namespace reanimated
 
 #endif // RCT_NEW_ARCH_ENABLED
@@ -51,6 +51,10 @@ struct SchedulerPublic : public UIManagerDelegate {
 const ContextContainer &getContextContainerFromUIManager(
     const UIManager &uiManager);
 
+// may be empty, React Native then does the work synchronously
+const BackgroundExecutor &getBackgroundExecutorFromUIManager(
+    const UIManager &uiManager);
+
 } // namespace reanimated
 
 #endif // RCT_NEW_ARCH_ENABLED
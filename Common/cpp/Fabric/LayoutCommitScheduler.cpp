@@ -0,0 +1,146 @@
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include "LayoutCommitScheduler.h"
+
+#include <utility>
+
+#include "ReanimatedCommitMarker.h"
+#include "ShadowTreeCloner.h"
+
+namespace reanimated {
+
+LayoutCommitScheduler::LayoutCommitScheduler(
+    const std::shared_ptr<UIManager> &uiManager,
+    const std::shared_ptr<PropsRegistry> &propsRegistry,
+    const std::shared_ptr<FrameTimingRecorder> &frameTimingRecorder,
+    BackgroundExecutor backgroundExecutor)
+    : uiManager_(uiManager),
+      propsRegistry_(propsRegistry),
+      frameTimingRecorder_(frameTimingRecorder),
+      backgroundExecutor_(std::move(backgroundExecutor)) {}
+
+void LayoutCommitScheduler::scheduleCommit(
+    SurfaceId surfaceId,
+    const std::vector<Tag> &tags) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &surface = surfaces_[surfaceId];
+    surface.pendingTags.insert(tags.begin(), tags.end());
+    if (surface.isCommitting) {
+      // picked up by the next commit, with the props from the latest frame
+      return;
+    }
+    surface.isCommitting = true;
+  }
+  post(surfaceId);
+}
+
+void LayoutCommitScheduler::remove(const std::vector<Tag> &tags) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &[surfaceId, surface] : surfaces_) {
+    if (surface.isCommitting) {
+      surface.removedTags.insert(
+          surface.removedTags.end(), tags.begin(), tags.end());
+      continue;
+    }
+    for (const auto tag : tags) {
+      surface.ancestorPathCache.remove(tag);
+    }
+  }
+}
+
+void LayoutCommitScheduler::post(SurfaceId surfaceId) {
+  backgroundExecutor_(
+      [weakThis = weak_from_this(), surfaceId]() {
+        if (auto strongThis = weakThis.lock()) {
+          strongThis->commit(surfaceId);
+        }
+      });
+}
+
+void LayoutCommitScheduler::commit(SurfaceId surfaceId) {
+  std::unordered_set<Tag> tags;
+  AncestorPathCache *ancestorPathCache;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &surface = surfaces_[surfaceId];
+    std::swap(tags, surface.pendingTags);
+    // the map's nodes are never moved
+    ancestorPathCache = &surface.ancestorPathCache;
+  }
+
+  if (propsRegistry_->shouldSkipCommit(surfaceId)) {
+    // React Native is committing to this surface, the updates will be applied
+    // in ReanimatedCommitHook
+    for (const auto tag : tags) {
+      propsRegistry_->markUncommitted(surfaceId, tag);
+    }
+  } else {
+    if (frameTimingRecorder_) {
+      frameTimingRecorder_->setCurrentThreadName("Reanimated layout commit");
+    }
+    FrameTimingScope commitTiming(
+        frameTimingRecorder_.get(), FramePhase::Commit);
+    commitTiming.setCount(tags.size());
+
+    // keeps the families alive
+    const auto snapshot = propsRegistry_->getSnapshot();
+    std::vector<std::pair<const ShadowNodeFamily *, folly::dynamic>> updates;
+    updates.reserve(tags.size());
+    for (const auto tag : tags) {
+      snapshot->visit(
+          tag, [&](const ShadowNodeFamily &family, folly::dynamic props) {
+            updates.emplace_back(&family, std::move(props));
+          });
+    }
+
+    bool committed = true;
+    uiManager_->getShadowTreeRegistry().visit(
+        surfaceId, [&](ShadowTree const &shadowTree) {
+          ReanimatedCommitMarker commitMarker;
+
+          const auto status = shadowTree.commit(
+              [&](RootShadowNode const &oldRootShadowNode) {
+                auto rootNode =
+                    oldRootShadowNode.ShadowNode::clone(ShadowNodeFragment{});
+
+                ShadowTreeCloner shadowTreeCloner{
+                    *uiManager_, surfaceId, ancestorPathCache};
+                for (const auto &[family, props] : updates) {
+                  // copied, the commit may be retried
+                  shadowTreeCloner.updateProps(*family, RawProps(props));
+                }
+
+                return std::static_pointer_cast<RootShadowNode>(
+                    shadowTreeCloner.cloneWithNewProps(rootNode));
+              },
+              {/* default commit options */});
+          committed = status == ShadowTree::CommitStatus::Succeeded;
+        });
+    if (!committed) {
+      for (const auto tag : tags) {
+        propsRegistry_->markUncommitted(surfaceId, tag);
+      }
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &surface = surfaces_[surfaceId];
+    for (const auto tag : surface.removedTags) {
+      surface.ancestorPathCache.remove(tag);
+    }
+    surface.removedTags.clear();
+    if (surface.pendingTags.empty()) {
+      surface.isCommitting = false;
+      return;
+    }
+  }
+  // Posted again instead of looping, so that React Native's own work on the
+  // background thread isn't starved.
+  post(surfaceId);
+}
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
@@ -0,0 +1,78 @@
+#pragma once
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include <react/renderer/uimanager/UIManager.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "AncestorPathCache.h"
+#include "FrameTimingRecorder.h"
+#include "PropsRegistry.h"
+
+using namespace facebook;
+using namespace react;
+
+// Set to 1 to commit layout affecting props updates off the UI thread. Layout
+// props then reach the screen up to a frame later than the other props. Enabled
+// with `REANIMATED_ASYNC_LAYOUT_COMMIT=1 pod install` on iOS and with
+// `reanimatedAsyncLayoutCommit=true` in gradle.properties on Android.
+#ifndef REANIMATED_ASYNC_LAYOUT_COMMIT
+#define REANIMATED_ASYNC_LAYOUT_COMMIT 0
+#endif
+
+namespace reanimated {
+
+// Commits layout affecting props updates on React Native's background thread,
+// so that cloning, Yoga layout and diffing don't block the UI thread.
+//
+// There's at most one commit in flight per surface. Views updated meanwhile are
+// committed together by the next one, with their latest props taken from
+// PropsRegistry, so commits run at most a frame behind and intermediate frames
+// are dropped instead of queued.
+class LayoutCommitScheduler
+    : public std::enable_shared_from_this<LayoutCommitScheduler> {
+ public:
+  LayoutCommitScheduler(
+      const std::shared_ptr<UIManager> &uiManager,
+      const std::shared_ptr<PropsRegistry> &propsRegistry,
+      const std::shared_ptr<FrameTimingRecorder> &frameTimingRecorder,
+      BackgroundExecutor backgroundExecutor);
+
+  // UI thread only. The props of the views have to be published in
+  // PropsRegistry already.
+  void scheduleCommit(SurfaceId surfaceId, const std::vector<Tag> &tags);
+
+  // UI thread only. Forgets the paths of unmounted views.
+  void remove(const std::vector<Tag> &tags);
+
+ private:
+  struct Surface {
+    std::unordered_set<Tag> pendingTags;
+    bool isCommitting = false;
+    // used by the commit in flight, by remove() under mutex_ between commits
+    AncestorPathCache ancestorPathCache;
+    // removed while a commit was in flight, removed from the cache after it
+    std::vector<Tag> removedTags;
+  };
+
+  void post(SurfaceId surfaceId);
+
+  // background thread
+  void commit(SurfaceId surfaceId);
+
+  const std::shared_ptr<UIManager> uiManager_;
+  const std::shared_ptr<PropsRegistry> propsRegistry_;
+  const std::shared_ptr<FrameTimingRecorder> frameTimingRecorder_;
+  const BackgroundExecutor backgroundExecutor_;
+
+  std::mutex mutex_; // Protects `surfaces_`.
+  std::unordered_map<SurfaceId, Surface> surfaces_;
+};
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
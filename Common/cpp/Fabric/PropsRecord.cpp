@@ -0,0 +1,147 @@
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include "PropsRecord.h"
+
+#include <folly/Conv.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+namespace reanimated {
+
+void PropsRecord::update(
+    PropNameTable &propNames,
+    const folly::dynamic &props) {
+  for (const auto &[key, value] : props.items()) {
+    const auto &keyString = key.getString();
+    const auto name = propNames.intern(keyString);
+
+    if (value.isNumber()) {
+      const bool isInt = value.isInt();
+      const double number =
+          isInt ? static_cast<double>(value.getInt()) : value.getDouble();
+      auto it = std::find_if(
+          numbers_.begin(), numbers_.end(), [name](const NumberProp &prop) {
+            return prop.name == name;
+          });
+      if (it != numbers_.end()) {
+        // the common case, the same prop animated on every frame
+        it->isInt = isInt;
+        it->value = number;
+        continue;
+      }
+      erase(name);
+      numbers_.push_back(NumberProp{name, isInt, number});
+      continue;
+    }
+
+    if (keyString == "transform") {
+      Transform transform;
+      transform.name = name;
+      if (parseTransform(propNames, value, transform)) {
+        erase(name);
+        transform_ = transform;
+        hasTransform_ = true;
+        continue;
+      }
+    }
+
+    erase(name);
+    others_.emplace_back(name, value);
+  }
+}
+
+folly::dynamic PropsRecord::toDynamic(const PropNameTable &propNames) const {
+  auto result = folly::dynamic::object();
+  for (const auto &prop : numbers_) {
+    if (prop.isInt) {
+      result[propNames.getName(prop.name)] =
+          static_cast<int64_t>(prop.value);
+    } else {
+      result[propNames.getName(prop.name)] = prop.value;
+    }
+  }
+  if (hasTransform_) {
+    auto transform = folly::dynamic::array();
+    for (size_t i = 0; i < transform_.size; ++i) {
+      const auto &operation = transform_.operations[i];
+      const auto &name = propNames.getName(operation.name);
+      if (operation.unit == Unit::kNone) {
+        transform.push_back(folly::dynamic::object(name, operation.value));
+      } else {
+        const char *unit = operation.unit == Unit::kDeg ? "deg" : "rad";
+        transform.push_back(folly::dynamic::object(
+            name, folly::to<std::string>(operation.value, unit)));
+      }
+    }
+    result[propNames.getName(transform_.name)] = std::move(transform);
+  }
+  for (const auto &[name, value] : others_) {
+    result[propNames.getName(name)] = value;
+  }
+  return result;
+}
+
+bool PropsRecord::parseTransform(
+    PropNameTable &propNames,
+    const folly::dynamic &value,
+    Transform &transform) {
+  // Anything unusual, e.g. a matrix or a percentage, is stored as dynamic.
+  if (!value.isArray() || value.size() > kMaxTransformOperations) {
+    return false;
+  }
+  for (const auto &item : value) {
+    if (!item.isObject() || item.size() != 1) {
+      return false;
+    }
+    const auto &[key, operationValue] = *item.items().begin();
+    auto &operation = transform.operations[transform.size];
+    if (operationValue.isNumber()) {
+      operation.unit = Unit::kNone;
+      operation.value = operationValue.asDouble();
+    } else if (operationValue.isString()) {
+      const char *str = operationValue.c_str();
+      char *end = nullptr;
+      operation.value = std::strtod(str, &end);
+      const std::string_view unit(end);
+      if (end == str) {
+        return false;
+      } else if (unit == "deg") {
+        operation.unit = Unit::kDeg;
+      } else if (unit == "rad") {
+        operation.unit = Unit::kRad;
+      } else {
+        return false;
+      }
+    } else {
+      return false;
+    }
+    operation.name = propNames.intern(key.getString());
+    ++transform.size;
+  }
+  return true;
+}
+
+void PropsRecord::erase(PropNameId name) {
+  numbers_.erase(
+      std::remove_if(
+          numbers_.begin(),
+          numbers_.end(),
+          [name](const NumberProp &prop) { return prop.name == name; }),
+      numbers_.end());
+  if (hasTransform_ && transform_.name == name) {
+    hasTransform_ = false;
+  }
+  others_.erase(
+      std::remove_if(
+          others_.begin(),
+          others_.end(),
+          [name](const auto &prop) { return prop.first == name; }),
+      others_.end());
+}
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
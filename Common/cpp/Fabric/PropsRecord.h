@@ -0,0 +1,65 @@
+#pragma once
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include <folly/dynamic.h>
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "PropNameTable.h"
+
+namespace reanimated {
+
+// Props of a single view, as stored in PropsRegistry. Animated props are
+// mostly numbers and transforms, these are kept in typed slots, merging an
+// update into them doesn't allocate. Everything else falls back to
+// folly::dynamic.
+class PropsRecord {
+ public:
+  // Merges `props` over the current props, keys not in `props` are kept.
+  void update(PropNameTable &propNames, const folly::dynamic &props);
+
+  folly::dynamic toDynamic(const PropNameTable &propNames) const;
+
+ private:
+  enum class Unit : uint8_t { kNone, kDeg, kRad };
+
+  struct NumberProp {
+    PropNameId name;
+    bool isInt;
+    double value;
+  };
+
+  // a single `{ rotate: '45deg' }` like entry of the transform array
+  struct TransformOperation {
+    PropNameId name;
+    Unit unit;
+    double value;
+  };
+
+  static constexpr size_t kMaxTransformOperations = 8;
+
+  struct Transform {
+    PropNameId name;
+    uint8_t size = 0;
+    std::array<TransformOperation, kMaxTransformOperations> operations;
+  };
+
+  static bool parseTransform(
+      PropNameTable &propNames,
+      const folly::dynamic &value,
+      Transform &transform);
+
+  void erase(PropNameId name);
+
+  std::vector<NumberProp> numbers_;
+  bool hasTransform_ = false;
+  Transform transform_;
+  std::vector<std::pair<PropNameId, folly::dynamic>> others_;
+};
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
@@ -4,36 +4,130 @@
 
 namespace reanimated {
 
-std::lock_guard<std::mutex> PropsRegistry::createLock() const {
-  return std::lock_guard<std::mutex>(mutex_);
+std::optional<folly::dynamic> PropsRegistry::Snapshot::get(
+    const Tag tag) const {
+  const auto &shard = *shards_[getShardIndex(tag)];
+  const auto it = shard.find(tag);
+  if (it == shard.cend()) {
+    return std::nullopt;
+  }
+  return it->second->props.toDynamic(*propNames_);
+}
+
+void PropsRegistry::Snapshot::visit(
+    const Tag tag,
+    const std::function<
+        void(const ShadowNodeFamily &family, folly::dynamic props)> &callback)
+    const {
+  const auto &shard = *shards_[getShardIndex(tag)];
+  const auto it = shard.find(tag);
+  if (it != shard.cend()) {
+    callback(
+        it->second->shadowNode->getFamily(),
+        it->second->props.toDynamic(*propNames_));
+  }
+}
+
+PropsRegistry::PropsRegistry() {
+  auto snapshot = std::make_shared<Snapshot>();
+  const auto emptyShard = std::make_shared<const Snapshot::Shard>();
+  snapshot->shards_.fill(emptyShard);
+  snapshot->propNames_ = &propNames_;
+  snapshot_ = std::move(snapshot);
 }
 
 void PropsRegistry::update(
     const ShadowNode::Shared &shadowNode,
-    folly::dynamic &&props) {
+    const folly::dynamic &props) {
   const auto tag = shadowNode->getTag();
-  const auto it = map_.find(tag);
-  if (it == map_.cend()) {
-    // we need to store ShadowNode because `ShadowNode::getFamily`
-    // returns `ShadowNodeFamily const &` which is non-owning
-    map_[tag] = std::make_pair(shadowNode, props);
-  } else {
-    // no need to update `.first` because ShadowNodeFamily doesn't change
-    // merge new props with old props
-    it->second.second.update(props);
+  auto &entry = getStagedShard(tag)[tag];
+  // no need to update `shadowNode` if there's an entry already because
+  // ShadowNodeFamily doesn't change, merge new props with old props, the old
+  // entry may still be read
+  auto newEntry = entry == nullptr
+      ? std::make_shared<Snapshot::Entry>(Snapshot::Entry{shadowNode, {}})
+      : std::make_shared<Snapshot::Entry>(*entry);
+  newEntry->props.update(propNames_, props);
+  entry = std::move(newEntry);
+}
+
+void PropsRegistry::remove(const Tag tag) {
+  const auto &shard = *snapshot_->shards_[Snapshot::getShardIndex(tag)];
+  const auto &stagedShard = stagedShards_[Snapshot::getShardIndex(tag)];
+  if (stagedShard == nullptr && shard.find(tag) == shard.cend()) {
+    // don't copy the shard just to find out there's nothing to remove
+    return;
+  }
+  getStagedShard(tag).erase(tag);
+  {
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+    for (auto &[_, tags] : uncommittedTags_) {
+      tags.erase(tag);
+    }
   }
 }
 
-void PropsRegistry::for_each(std::function<void(
-                                 const ShadowNodeFamily &family,
-                                 const folly::dynamic &props)> callback) const {
-  for (const auto &[_, value] : map_) {
-    callback(value.first->getFamily(), value.second);
+void PropsRegistry::publish() {
+  if (!hasStagedChanges_) {
+    return;
+  }
+  auto snapshot = std::make_shared<Snapshot>(*snapshot_);
+  for (size_t i = 0; i < Snapshot::kShardCount; ++i) {
+    if (stagedShards_[i] != nullptr) {
+      snapshot->shards_[i] = std::move(stagedShards_[i]);
+      stagedShards_[i] = nullptr;
+    }
   }
+  hasStagedChanges_ = false;
+  std::atomic_store(
+      &snapshot_, std::shared_ptr<const Snapshot>(std::move(snapshot)));
 }
 
-void PropsRegistry::remove(const Tag tag) {
-  map_.erase(tag);
+void PropsRegistry::markUncommitted(const SurfaceId surfaceId, const Tag tag) {
+  std::lock_guard<std::mutex> lock(surfacesMutex_);
+  uncommittedTags_[surfaceId].insert(tag);
+}
+
+void PropsRegistry::takeUncommitted(
+    const SurfaceId surfaceId,
+    const Snapshot &snapshot,
+    std::function<void(const ShadowNodeFamily &family, folly::dynamic props)>
+        callback) {
+  std::unordered_set<Tag> tags;
+  {
+    std::lock_guard<std::mutex> lock(surfacesMutex_);
+    auto it = uncommittedTags_.find(surfaceId);
+    if (it == uncommittedTags_.end()) {
+      return;
+    }
+    tags = std::move(it->second);
+    uncommittedTags_.erase(it);
+  }
+  for (const auto tag : tags) {
+    snapshot.visit(tag, callback);
+  }
+}
+
+void PropsRegistry::pleaseSkipCommit(const SurfaceId surfaceId) {
+  std::lock_guard<std::mutex> lock(surfacesMutex_);
+  surfacesToSkip_.insert(surfaceId);
+}
+
+bool PropsRegistry::shouldSkipCommit(const SurfaceId surfaceId) {
+  std::lock_guard<std::mutex> lock(surfacesMutex_);
+  return surfacesToSkip_.erase(surfaceId) != 0;
+}
+
+PropsRegistry::Snapshot::Shard &PropsRegistry::getStagedShard(const Tag tag) {
+  const auto index = Snapshot::getShardIndex(tag);
+  auto &stagedShard = stagedShards_[index];
+  if (stagedShard == nullptr) {
+    // copy on write, the published shard may be read on other threads
+    stagedShard =
+        std::make_shared<Snapshot::Shard>(*snapshot_->shards_[index]);
+    hasStagedChanges_ = true;
+  }
+  return *stagedShard;
 }
 
 } // namespace reanimated
@@ -4,41 +4,122 @@
 #include <react/renderer/components/root/RootShadowNode.h>
 #include <react/renderer/core/ShadowNode.h>
 
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
+#include "PropNameTable.h"
+#include "PropsRecord.h"
+
 using namespace facebook;
 using namespace react;
 
 namespace reanimated {
 
+// Props of the animated views, applied again in ReanimatedCommitHook so that
+// React doesn't overwrite them.
+//
+// The UI thread changes the registry on every frame, while React commits read
+// it on the JS thread. To not block one another, readers get an immutable
+// snapshot and the UI thread publishes a new one after every batch of
+// changes. Snapshots are split into shards and only the shards with changed
+// views are copied, the rest is shared with the previous snapshot.
 class PropsRegistry {
  public:
-  std::lock_guard<std::mutex> createLock() const;
-  // returns a lock you need to hold when calling any of the methods below
+  class Snapshot {
+   public:
+    // returns std::nullopt if there are no props stored for the view
+    std::optional<folly::dynamic> get(const Tag tag) const;
 
-  void update(const ShadowNode::Shared &shadowNode, folly::dynamic &&props);
+    // Calls `callback` with the family and the props of the view, if there
+    // are props stored for it.
+    void visit(
+        const Tag tag,
+        const std::function<
+            void(const ShadowNodeFamily &family, folly::dynamic props)>
+            &callback) const;
 
-  void for_each(std::function<void(
-                    const ShadowNodeFamily &family,
-                    const folly::dynamic &props)> callback) const;
+   private:
+    friend class PropsRegistry;
 
-  void remove(const Tag tag);
+    struct Entry {
+      // we need to store ShadowNode because `ShadowNode::getFamily`
+      // returns `ShadowNodeFamily const &` which is non-owning
+      ShadowNode::Shared shadowNode;
+      PropsRecord props;
+    };
+    using Shard = std::unordered_map<Tag, std::shared_ptr<const Entry>>;
 
-  void pleaseSkipCommit() {
-    letMeIn_ = true;
-  }
+    static constexpr unsigned kShardBits = 5;
+    static constexpr size_t kShardCount = 1 << kShardBits;
+
+    static size_t getShardIndex(const Tag tag) {
+      // Fabric tags are all even or all odd, a multiplicative hash spreads
+      // them over all the shards
+      return (static_cast<uint32_t>(tag) * 2654435761u) >> (32 - kShardBits);
+    }
+
+    std::array<std::shared_ptr<const Shard>, kShardCount> shards_;
+    const PropNameTable *propNames_;
+  };
 
-  bool shouldSkipCommit() {
-    return letMeIn_.exchange(false);
+  PropsRegistry();
+
+  // Can be called on any thread, never blocks the UI thread.
+  std::shared_ptr<const Snapshot> getSnapshot() const {
+    return std::atomic_load(&snapshot_);
   }
 
+  // The methods below are UI thread only. The changes are visible in the
+  // snapshots after `publish` is called.
+
+  void update(
+      const ShadowNode::Shared &shadowNode,
+      const folly::dynamic &props);
+
+  void remove(const Tag tag);
+
+  void publish();
+
+  // Marks props which were stored but couldn't be committed, the next React
+  // commit of the surface applies them even if React didn't touch the view.
+  void markUncommitted(const SurfaceId surfaceId, const Tag tag);
+
+  // Calls `callback` for the props from `snapshot` marked with
+  // `markUncommitted` for `surfaceId` and clears the marks.
+  void takeUncommitted(
+      const SurfaceId surfaceId,
+      const Snapshot &snapshot,
+      std::function<void(const ShadowNodeFamily &family, folly::dynamic props)>
+          callback);
+
+  void pleaseSkipCommit(const SurfaceId surfaceId);
+
+  bool shouldSkipCommit(const SurfaceId surfaceId);
+
  private:
-  std::unordered_map<Tag, std::pair<ShadowNode::Shared, folly::dynamic>> map_;
+  Snapshot::Shard &getStagedShard(const Tag tag);
+
+  // keys of the stored props, only grows
+  PropNameTable propNames_;
+
+  std::shared_ptr<const Snapshot> snapshot_;
 
-  mutable std::mutex mutex_; // Protects `map_`.
+  // shards copied since the last `publish`, UI thread only
+  std::array<std::shared_ptr<Snapshot::Shard>, Snapshot::kShardCount>
+      stagedShards_;
+  bool hasStagedChanges_ = false;
 
-  std::atomic<bool> letMeIn_;
+  std::unordered_map<SurfaceId, std::unordered_set<Tag>> uncommittedTags_;
+  std::unordered_set<SurfaceId> surfacesToSkip_;
+  // Protects `uncommittedTags_` and `surfacesToSkip_`.
+  std::mutex surfacesMutex_;
 };
 
 } // namespace reanimated
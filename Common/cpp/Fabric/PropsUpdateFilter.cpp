@@ -0,0 +1,104 @@
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include "PropsUpdateFilter.h"
+
+#include <jsi/JSIDynamic.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace reanimated {
+
+namespace {
+
+bool isEqual(const folly::dynamic &a, const folly::dynamic &b, double epsilon) {
+  if (a.isNumber() && b.isNumber()) {
+    return std::abs(a.asDouble() - b.asDouble()) <= epsilon;
+  }
+  if (a.type() != b.type()) {
+    return false;
+  }
+  if (a.isArray()) {
+    return a.size() == b.size() &&
+        std::equal(
+               a.begin(),
+               a.end(),
+               b.begin(),
+               [epsilon](const folly::dynamic &x, const folly::dynamic &y) {
+                 return isEqual(x, y, epsilon);
+               });
+  }
+  if (a.isObject()) {
+    if (a.size() != b.size()) {
+      return false;
+    }
+    for (const auto &[key, value] : a.items()) {
+      const auto *other = b.get_ptr(key);
+      if (other == nullptr || !isEqual(value, *other, epsilon)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return a == b;
+}
+
+} // namespace
+
+folly::dynamic PropsUpdateFilter::filter(
+    jsi::Runtime &rt,
+    Tag tag,
+    const PropsShape &shape,
+    const jsi::Object &props,
+    uint8_t &kinds) {
+  const double epsilon = epsilon_;
+  auto &lastProps = lastProps_[tag];
+  auto result = folly::dynamic::object();
+  kinds = kUnknownProp;
+  uint64_t suppressedProps = 0;
+  uint64_t jsiConversions = 0;
+
+  for (size_t i = 0; i < shape.ids.size(); ++i) {
+    const auto name = shape.ids[i];
+    const auto value = props.getProperty(rt, shape.names[i]);
+    auto it = std::find_if(
+        lastProps.begin(), lastProps.end(), [name](const LastProp &prop) {
+          return prop.name == name;
+        });
+
+    // numbers, the most common case, are compared without the conversion
+    if (value.isNumber() && it != lastProps.end() && it->value.isNumber() &&
+        std::abs(value.getNumber() - it->value.asDouble()) <= epsilon) {
+      ++suppressedProps;
+      continue;
+    }
+    auto dynamicValue = jsi::dynamicFromValue(rt, value);
+    ++jsiConversions;
+    if (it != lastProps.end() && !value.isNumber() &&
+        isEqual(dynamicValue, it->value, epsilon)) {
+      ++suppressedProps;
+      continue;
+    }
+
+    if (it != lastProps.end()) {
+      it->value = dynamicValue;
+    } else {
+      lastProps.push_back(LastProp{name, dynamicValue});
+    }
+    result[shape.keys[i]] = std::move(dynamicValue);
+    kinds |= shape.propKinds[i];
+  }
+
+  sentProps_ += shape.ids.size() - suppressedProps;
+  suppressedProps_ += suppressedProps;
+  jsiConversions_ += jsiConversions;
+  if (result.empty()) {
+    ++suppressedUpdates_;
+  }
+  return result;
+}
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
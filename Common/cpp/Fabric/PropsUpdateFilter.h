@@ -0,0 +1,83 @@
+#pragma once
+#ifdef RCT_NEW_ARCH_ENABLED
+
+#include <folly/dynamic.h>
+#include <jsi/jsi.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "PropNameTable.h"
+
+using namespace facebook;
+using namespace react;
+
+namespace reanimated {
+
+// Remembers the props last sent to every view and drops the ones which didn't
+// change since, e.g. when a spring has settled or a mapper recomputed an equal
+// style, before they are converted and sent to the platform.
+//
+// Only safe on Fabric: when React overwrites animated props,
+// ReanimatedCommitHook brings back the values from PropsRegistry, which are
+// the ones remembered here.
+//
+// `filter` and `remove` are UI thread only, the epsilon and the stats can be
+// accessed from any thread.
+class PropsUpdateFilter {
+ public:
+  struct Stats {
+    // props sent to the platform
+    uint64_t sentProps;
+    // props dropped because they didn't change
+    uint64_t suppressedProps;
+    // updates dropped as a whole because none of their props changed
+    uint64_t suppressedUpdates;
+    // prop values converted from JSI, at most one per prop of an update
+    uint64_t jsiConversions;
+  };
+
+  // Numbers, also the ones nested in e.g. transforms, which differ from the
+  // last sent value by at most `epsilon` count as unchanged. 0 by default.
+  void setEpsilon(double epsilon) {
+    epsilon_ = epsilon;
+  }
+
+  // Returns the props of `props` which changed since they were last sent to
+  // the view and remembers them as sent. `shape` has to be the shape of
+  // `props`, `kinds` gets the kinds of the returned props.
+  folly::dynamic filter(
+      jsi::Runtime &rt,
+      Tag tag,
+      const PropsShape &shape,
+      const jsi::Object &props,
+      uint8_t &kinds);
+
+  void remove(Tag tag) {
+    lastProps_.erase(tag);
+  }
+
+  Stats getStats() const {
+    return {sentProps_, suppressedProps_, suppressedUpdates_, jsiConversions_};
+  }
+
+ private:
+  struct LastProp {
+    PropNameId name;
+    folly::dynamic value;
+  };
+
+  std::unordered_map<Tag, std::vector<LastProp>> lastProps_;
+  std::atomic<double> epsilon_{0};
+  std::atomic<uint64_t> sentProps_{0};
+  std::atomic<uint64_t> suppressedProps_{0};
+  std::atomic<uint64_t> suppressedUpdates_{0};
+  std::atomic<uint64_t> jsiConversions_{0};
+};
+
+} // namespace reanimated
+
+#endif // RCT_NEW_ARCH_ENABLED
@@ -2,6 +2,10 @@
 
 #include <react/renderer/core/ComponentDescriptor.h>
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "ReanimatedCommitHook.h"
 #include "ReanimatedCommitMarker.h"
 #include "ShadowTreeCloner.h"
@@ -10,6 +14,64 @@ using namespace facebook::react;
 
 namespace reanimated {
 
+namespace {
+
+void collectAllNodes(
+    const ShadowNode &node,
+    std::vector<const ShadowNode *> &nodes) {
+  nodes.push_back(&node);
+  for (const auto &child : node.getChildren()) {
+    collectAllNodes(*child, nodes);
+  }
+}
+
+// Collects the nodes of `newNode` subtree whose props differ from the ones in
+// the committed tree. Subtrees shared by both trees are skipped as a whole.
+void collectChangedNodes(
+    const ShadowNode &oldNode,
+    const ShadowNode &newNode,
+    std::vector<const ShadowNode *> &nodes) {
+  if (&oldNode == &newNode) {
+    return;
+  }
+  if (oldNode.getProps() != newNode.getProps()) {
+    nodes.push_back(&newNode);
+  }
+
+  const auto &oldChildren = oldNode.getChildren();
+  const auto &newChildren = newNode.getChildren();
+  if (&oldChildren == &newChildren) {
+    return;
+  }
+  // built only if the children were reordered, inserted or removed
+  std::unordered_map<Tag, const ShadowNode *> oldChildrenByTag;
+  for (size_t i = 0; i < newChildren.size(); ++i) {
+    const auto &newChild = *newChildren[i];
+    const ShadowNode *oldChild = nullptr;
+    if (i < oldChildren.size() &&
+        oldChildren[i]->getTag() == newChild.getTag()) {
+      oldChild = oldChildren[i].get();
+    } else {
+      if (oldChildrenByTag.empty()) {
+        for (const auto &child : oldChildren) {
+          oldChildrenByTag.emplace(child->getTag(), child.get());
+        }
+      }
+      auto it = oldChildrenByTag.find(newChild.getTag());
+      if (it != oldChildrenByTag.end()) {
+        oldChild = it->second;
+      }
+    }
+    if (oldChild != nullptr) {
+      collectChangedNodes(*oldChild, newChild, nodes);
+    } else {
+      collectAllNodes(newChild, nodes);
+    }
+  }
+}
+
+} // namespace
+
 ReanimatedCommitHook::ReanimatedCommitHook(
     const std::shared_ptr<PropsRegistry> &propsRegistry,
     const std::shared_ptr<UIManager> &uiManager)
@@ -23,7 +85,7 @@ ReanimatedCommitHook::~ReanimatedCommitHook() noexcept {
 
 RootShadowNode::Unshared ReanimatedCommitHook::shadowTreeWillCommit(
     ShadowTree const &,
-    RootShadowNode::Shared const &,
+    RootShadowNode::Shared const &oldRootShadowNode,
     RootShadowNode::Unshared const &newRootShadowNode) const noexcept {
   if (ReanimatedCommitMarker::isReanimatedCommit()) {
     // ShadowTree commited by Reanimated, no need to apply updates from
@@ -33,33 +95,46 @@ RootShadowNode::Unshared ReanimatedCommitHook::shadowTreeWillCommit(
 
   // ShadowTree not commited by Reanimated, apply updates from PropsRegistry
 
-  auto surfaceId = newRootShadowNode->getSurfaceId();
+  // React builds the new tree from its own nodes, so every node React
+  // touched, and every node Reanimated cloned since the last React commit,
+  // differs from the committed one. Only these can have lost animated props,
+  // the others still have whatever was committed or applied directly.
+  std::vector<const ShadowNode *> changedNodes;
+  collectChangedNodes(*oldRootShadowNode, *newRootShadowNode, changedNodes);
 
-  auto rootNode = newRootShadowNode->ShadowNode::clone(ShadowNodeFragment{});
+  auto surfaceId = newRootShadowNode->getSurfaceId();
 
   ShadowTreeCloner shadowTreeCloner{*uiManager_, surfaceId};
 
-  {
-    auto lock = propsRegistry_->createLock();
-
-    propsRegistry_->for_each([&](const ShadowNodeFamily &family,
-                                 const folly::dynamic &props) {
-      auto newRootNode =
-          shadowTreeCloner.cloneWithNewProps(rootNode, family, RawProps(props));
+  // doesn't block the UI thread, which may publish newer props meanwhile
+  const auto snapshot = propsRegistry_->getSnapshot();
 
-      if (newRootNode == nullptr) {
-        // this happens when React removed the component but Reanimated
-        // still tries to animate it, let's skip update for this specific
-        // component
-        return;
-      }
-      rootNode = newRootNode;
-    });
+  bool hasUpdates = false;
+  for (const auto *node : changedNodes) {
+    if (auto props = snapshot->get(node->getTag())) {
+      shadowTreeCloner.updateProps(
+          node->getFamily(), RawProps(std::move(*props)));
+      hasUpdates = true;
+    }
   }
+  propsRegistry_->takeUncommitted(
+      surfaceId,
+      *snapshot,
+      [&](const ShadowNodeFamily &family, folly::dynamic props) {
+        shadowTreeCloner.updateProps(family, RawProps(std::move(props)));
+        hasUpdates = true;
+      });
 
   // request Reanimated to skip one commit so that React Native can mount the
   // changes instead of failing 1024 times and crashing the app
-  propsRegistry_->pleaseSkipCommit();
+  propsRegistry_->pleaseSkipCommit(surfaceId);
+
+  if (!hasUpdates) {
+    return newRootShadowNode;
+  }
+
+  auto rootNode = newRootShadowNode->ShadowNode::clone(ShadowNodeFragment{});
+  rootNode = shadowTreeCloner.cloneWithNewProps(rootNode);
 
   return std::static_pointer_cast<RootShadowNode>(rootNode);
 }
@@ -7,60 +7,107 @@ namespace reanimated {
 
 ShadowTreeCloner::ShadowTreeCloner(
     const UIManager &uiManager,
-    SurfaceId surfaceId)
+    SurfaceId surfaceId,
+    AncestorPathCache *ancestorPathCache)
     : propsParserContext_{
           surfaceId,
-          getContextContainerFromUIManager(uiManager)} {}
+          getContextContainerFromUIManager(uiManager)},
+      ancestorPathCache_(ancestorPathCache) {}
 
-ShadowNode::Unshared ShadowTreeCloner::cloneWithNewProps(
-    const ShadowNode::Shared &oldRootNode,
+void ShadowTreeCloner::updateProps(
     const ShadowNodeFamily &family,
     RawProps &&rawProps) {
-  // adapted from ShadowNode::cloneTree
+  updates_.emplace_back(&family, std::move(rawProps));
+}
 
-  auto ancestors = family.getAncestors(*oldRootNode);
+ShadowNode::Unshared ShadowTreeCloner::cloneWithNewProps(
+    const ShadowNode::Shared &oldRootNode) {
+  // adapted from ShadowNode::cloneTree, but for many nodes at once
 
-  if (ancestors.empty()) {
-    return ShadowNode::Unshared{nullptr};
-  }
+  PathNodes pathNodes;
+  pathNodes.reserve(updates_.size() * 2);
 
-  auto &parent = ancestors.back();
-  auto &source = parent.first.get().getChildren().at(parent.second);
+  for (auto &[family, rawProps] : updates_) {
+    auto ancestors = ancestorPathCache_ != nullptr
+        ? ancestorPathCache_->getAncestors(*family, *oldRootNode)
+        : family->getAncestors(*oldRootNode);
 
-  const auto props = source->getComponentDescriptor().cloneProps(
-      propsParserContext_, source->getProps(), rawProps);
+    if (ancestors.empty()) {
+      continue;
+    }
 
-  auto newChildNode = source->clone({/* .props = */ props});
+    auto &parent = ancestors.back();
+    const auto *node =
+        parent.first.get().getChildren().at(parent.second).get();
+    auto [nodeIt, isNewNode] = pathNodes.try_emplace(node);
+    nodeIt->second.rawProps.push_back(&rawProps);
+    if (!isNewNode) {
+      // the path to the root is already there
+      continue;
+    }
 
-  for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
-    auto &parentNode = it->first.get();
-    auto childIndex = it->second;
+    // walk up until we reach a path added by one of the previous updates
+    for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+      auto [parentIt, isNewParent] = pathNodes.try_emplace(&it->first.get());
+      parentIt->second.childIndices.push_back(it->second);
+      if (!isNewParent) {
+        break;
+      }
+    }
+  }
 
-    auto children = parentNode.getChildren();
-    const auto &oldChildNode = *children.at(childIndex);
-    react_native_assert(ShadowNode::sameFamily(oldChildNode, *newChildNode));
+  ShadowNode::Shared newRootNode = oldRootNode;
+  if (pathNodes.find(oldRootNode.get()) != pathNodes.end()) {
+    newRootNode = cloneRecursive(oldRootNode, pathNodes);
+  }
+  updates_.clear();
+  return std::const_pointer_cast<ShadowNode>(newRootNode);
+}
 
-    if (!parentNode.getSealed()) {
-      // Optimization: if a ShadowNode is unsealed, we can directly update its
-      // children instead of cloning the whole path to the root node.
-      auto &parentNodeNonConst = const_cast<ShadowNode &>(parentNode);
-      parentNodeNonConst.replaceChild(oldChildNode, newChildNode, childIndex);
-      // Unfortunately, `replaceChild` does not update Yoga nodes, so we need to
-      // update them manually here.
-      static_cast<YogaLayoutableShadowNode *>(&parentNodeNonConst)
-          ->updateYogaChildren();
-      return std::const_pointer_cast<ShadowNode>(oldRootNode);
+ShadowNode::Shared ShadowTreeCloner::cloneRecursive(
+    const ShadowNode::Shared &node,
+    PathNodes &pathNodes) {
+  auto &pathNode = pathNodes.at(node.get());
+
+  if (!node->getSealed() && pathNode.rawProps.empty()) {
+    // Optimization: if a ShadowNode is unsealed, we can directly update its
+    // children instead of cloning the whole path to the root node.
+    auto &nodeNonConst = const_cast<ShadowNode &>(*node);
+    for (auto childIndex : pathNode.childIndices) {
+      // keeps the old child alive until it's replaced
+      auto oldChildNode = node->getChildren().at(childIndex);
+      auto newChildNode = cloneRecursive(oldChildNode, pathNodes);
+      react_native_assert(ShadowNode::sameFamily(*oldChildNode, *newChildNode));
+      nodeNonConst.replaceChild(*oldChildNode, newChildNode, childIndex);
     }
+    // Unfortunately, `replaceChild` does not update Yoga nodes, so we need to
+    // update them manually here, once for all replaced children.
+    static_cast<YogaLayoutableShadowNode *>(&nodeNonConst)
+        ->updateYogaChildren();
+    return node;
+  }
 
-    children[childIndex] = newChildNode;
+  auto children = ShadowNodeFragment::childrenPlaceholder();
+  if (!pathNode.childIndices.empty()) {
+    auto newChildren =
+        std::make_shared<ShadowNode::ListOfShared>(node->getChildren());
+    for (auto childIndex : pathNode.childIndices) {
+      auto &childNode = newChildren->at(childIndex);
+      childNode = cloneRecursive(childNode, pathNodes);
+    }
+    children = newChildren;
+  }
 
-    newChildNode = parentNode.clone({
-        ShadowNodeFragment::propsPlaceholder(),
-        std::make_shared<ShadowNode::ListOfShared>(children),
-    });
+  auto props = ShadowNodeFragment::propsPlaceholder();
+  if (!pathNode.rawProps.empty()) {
+    props = node->getProps();
+    for (auto *rawProps : pathNode.rawProps) {
+      props = node->getComponentDescriptor().cloneProps(
+          propsParserContext_, props, *rawProps);
+    }
   }
 
-  return std::const_pointer_cast<ShadowNode>(newChildNode);
+  return node->clone({props, children});
 }
 
 } // namespace reanimated
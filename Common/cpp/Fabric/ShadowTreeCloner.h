@@ -5,24 +5,57 @@
 #include <react/renderer/uimanager/UIManager.h>
 
 #include <memory>
-#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "AncestorPathCache.h"
 
 using namespace facebook;
 using namespace react;
 
 namespace reanimated {
 
+// Applies a batch of props updates to a shadow tree. Every node on the paths
+// from the root to the updated nodes is cloned at most once, no matter how many
+// of the updated nodes are below it, and nodes that are already unsealed (e.g.
+// cloned earlier in the same commit) are updated in place with a single
+// `updateYogaChildren` call.
 class ShadowTreeCloner {
  public:
-  ShadowTreeCloner(const UIManager &uiManager, SurfaceId surfaceId);
-
+  // The paths to the updated nodes are looked up in `ancestorPathCache`, if
+  // given, instead of being searched for.
+  ShadowTreeCloner(
+      const UIManager &uiManager,
+      SurfaceId surfaceId,
+      AncestorPathCache *ancestorPathCache = nullptr);
+
+  // Queues new props for the node of `family`. Updates of the same node are
+  // applied in the order they were queued.
+  void updateProps(const ShadowNodeFamily &family, RawProps &&rawProps);
+
+  // Returns the new root with all queued updates applied and clears the
+  // queue. Updates of nodes that are no longer in the tree (React removed the
+  // component but Reanimated still tries to animate it) are skipped.
   ShadowNode::Unshared cloneWithNewProps(
-      const ShadowNode::Shared &oldRootNode,
-      const ShadowNodeFamily &family,
-      RawProps &&rawProps);
+      const ShadowNode::Shared &oldRootNode);
 
  private:
+  // A node on a path from the root to an updated node.
+  struct PathNode {
+    // indices of the children that are on a path too
+    std::vector<int> childIndices;
+    std::vector<RawProps *> rawProps;
+  };
+  using PathNodes = std::unordered_map<const ShadowNode *, PathNode>;
+
+  ShadowNode::Shared cloneRecursive(
+      const ShadowNode::Shared &node,
+      PathNodes &pathNodes);
+
   PropsParserContext propsParserContext_;
+  AncestorPathCache *const ancestorPathCache_;
+  std::vector<std::pair<const ShadowNodeFamily *, RawProps>> updates_;
 };
 
 } // namespace reanimated
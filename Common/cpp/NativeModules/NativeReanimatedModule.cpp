@@ -6,10 +6,14 @@
 #include <react/renderer/uimanager/primitives.h>
 #endif
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #ifdef RCT_NEW_ARCH_ENABLED
 #include "FabricUtils.h"
@@ -33,6 +37,23 @@ using namespace facebook;
 
 namespace reanimated {
 
+namespace {
+
+std::vector<SharedValueId> getSharedValueIds(
+    jsi::Runtime &rt,
+    const jsi::Value &value) {
+  const auto array = value.asObject(rt).asArray(rt);
+  const size_t size = array.size(rt);
+  std::vector<SharedValueId> ids;
+  ids.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    ids.push_back(array.getValueAtIndex(rt, i).asNumber());
+  }
+  return ids;
+}
+
+} // namespace
+
 NativeReanimatedModule::NativeReanimatedModule(
     const std::shared_ptr<CallInvoker> &jsInvoker,
     const std::shared_ptr<UIScheduler> &uiScheduler,
@@ -60,19 +81,63 @@ NativeReanimatedModule::NativeReanimatedModule(
           platformDepMethodsHolder.configurePropsFunction)
 #endif
 {
-  auto requestAnimationFrame = [=](jsi::Runtime &rt, const jsi::Value &fn) {
-    auto jsFunction = std::make_shared<jsi::Value>(rt, fn);
-    frameCallbacks.push_back([=](double timestamp) {
-      runtimeHelper->runOnUIGuarded(*jsFunction, jsi::Value(timestamp));
-    });
+  auto requestAnimationFrame = [this](jsi::Runtime &rt, const jsi::Value &fn) {
+    frameCallbackRegistry_.requestFrame(
+        [this, callback = jsi::Value(rt, fn)](double timestamp) {
+          runtimeHelper->runOnUIGuarded(callback, jsi::Value(timestamp));
+        });
     maybeRequestRender();
   };
 
+  auto startNativeAnimation = [this](
+                                  jsi::Runtime &rt,
+                                  const jsi::Value &sharedValue,
+                                  const jsi::Value &animation,
+                                  const jsi::Value &config) {
+    auto id = nativeAnimationDriver_.start(rt, sharedValue, animation, config);
+    maybeRequestRender();
+    return jsi::Value(static_cast<double>(id));
+  };
+
+  auto stopNativeAnimation = [this](
+                                 jsi::Runtime &rt,
+                                 const jsi::Value &animationId) {
+    nativeAnimationDriver_.stop(rt, animationId.asNumber());
+  };
+
+  auto startMapper = [this](
+                         jsi::Runtime &rt,
+                         const jsi::Value &mapperId,
+                         const jsi::Value &worklet,
+                         const jsi::Value &inputs,
+                         const jsi::Value &outputs) {
+    mapperRegistry_.startMapper(
+        mapperId.asNumber(),
+        worklet.asObject(rt).asFunction(rt),
+        getSharedValueIds(rt, inputs),
+        getSharedValueIds(rt, outputs));
+  };
+
+  auto stopMapper = [this](jsi::Runtime &, const jsi::Value &mapperId) {
+    mapperRegistry_.stopMapper(mapperId.asNumber());
+  };
+
+  auto markMapperInputDirty = [this](
+                                  jsi::Runtime &,
+                                  const jsi::Value &sharedValueId) {
+    mapperRegistry_.markInputDirty(sharedValueId.asNumber());
+  };
+
   auto scheduleOnJS = [this](
                           jsi::Runtime &rt,
                           const jsi::Value &remoteFun,
-                          const jsi::Value &argsValue) {
-    this->scheduleOnJS(rt, remoteFun, argsValue);
+                          const jsi::Value &argsValue,
+                          const jsi::Value &latestWins) {
+    this->scheduleOnJS(
+        rt,
+        remoteFun,
+        argsValue,
+        latestWins.isBool() && latestWins.getBool());
   };
 
   auto makeShareableClone = [this](jsi::Runtime &rt, const jsi::Value &value) {
@@ -125,6 +190,11 @@ NativeReanimatedModule::NativeReanimatedModule(
       platformDepMethodsHolder.dispatchCommandFunction,
 #endif
       requestAnimationFrame,
+      startNativeAnimation,
+      stopNativeAnimation,
+      startMapper,
+      stopMapper,
+      markMapperInputDirty,
       scheduleOnJS,
       makeShareableClone,
       updateDataSynchronously,
@@ -133,11 +203,77 @@ NativeReanimatedModule::NativeReanimatedModule(
       platformDepMethodsHolder.progressLayoutAnimation,
       platformDepMethodsHolder.endLayoutAnimation,
       platformDepMethodsHolder.maybeFlushUIUpdatesQueueFunction);
+  jsi::Runtime &uiRuntime = *runtimeManager_->runtime;
+  runNativeAnimations_ =
+      std::make_unique<jsi::Value>(jsi::Function::createFromHostFunction(
+          uiRuntime,
+          jsi::PropNameID::forAscii(uiRuntime, "runNativeAnimations"),
+          1,
+          [this](
+              jsi::Runtime &rt,
+              const jsi::Value &,
+              const jsi::Value *args,
+              size_t) {
+            FrameTimingScope timing(
+                frameTimingRecorder_.get(), FramePhase::NativeAnimations);
+            auto global = rt.global();
+            // same frame boundaries as for callbacks run by
+            // requestAnimationFrame
+            global.setProperty(rt, "__frameTimestamp", args[0]);
+            timing.setCount(
+                nativeAnimationDriver_.runFrame(rt, args[0].asNumber()));
+            global.setProperty(rt, "__frameTimestamp", jsi::Value::undefined());
+            // runs the mappers of the updated shared values
+            global.getPropertyAsFunction(rt, "__callMicrotasks").call(rt);
+            return jsi::Value::undefined();
+          }));
+  runMappers_ =
+      std::make_unique<jsi::Value>(jsi::Function::createFromHostFunction(
+          uiRuntime,
+          jsi::PropNameID::forAscii(uiRuntime, "runMappers"),
+          0,
+          [this](
+              jsi::Runtime &rt,
+              const jsi::Value &,
+              const jsi::Value *,
+              size_t) {
+            FrameTimingScope timing(
+                frameTimingRecorder_.get(), FramePhase::Mappers);
+            timing.setCount(mapperRegistry_.run(rt));
+            return jsi::Value::undefined();
+          }));
+  mapperRegistry_.setRequestRunFunction([this](bool nextFrame) {
+    // Same as the JS registry: mappers run in a microtask, after the worklet
+    // which updated their inputs. The ones made dirty by other mappers wait
+    // for the next frame.
+    jsi::Runtime &rt = *runtimeManager_->runtime;
+    rt.global()
+        .getPropertyAsFunction(
+            rt, nextFrame ? "requestAnimationFrame" : "queueMicrotask")
+        .call(rt, *runMappers_);
+  });
+
   onRenderCallback = [this](double timestampMs) {
     this->renderRequested = false;
     this->onRender(timestampMs);
   };
 
+  uiScheduler->setFrameTimingRecorder(frameTimingRecorder_);
+
+  // Deferrable UI jobs that didn't fit in the frame budget are resumed on the
+  // next frame.
+  uiScheduler->setRequestFrameFunction([this]() {
+    if (deferredUIJobsFrameRequested_) {
+      return;
+    }
+    deferredUIJobsFrameRequested_ = true;
+    frameCallbackRegistry_.requestFrame([this](double) {
+      deferredUIJobsFrameRequested_ = false;
+      runtimeManager_->uiScheduler_->triggerUI();
+    });
+    maybeRequestRender();
+  });
+
 #ifdef RCT_NEW_ARCH_ENABLED
   // nothing
 #else
@@ -175,13 +311,24 @@ void NativeReanimatedModule::installCoreFunctions(
 }
 
 NativeReanimatedModule::~NativeReanimatedModule() {
+  runtimeManager_->uiScheduler_->setRequestFrameFunction(nullptr);
+  // background runtimes use the core functions, so they have to be torn down
+  // first
+  workletRuntimePool_.reset();
   if (runtimeHelper) {
     runtimeHelper->callGuard = nullptr;
     runtimeHelper->valueUnpacker = nullptr;
     // event handler registry and frame callbacks store some JSI values from UI
     // runtime, so they have to go away before we tear down the runtime
     eventHandlerRegistry.reset();
-    frameCallbacks.clear();
+    frameCallbackRegistry_.clear();
+    nativeAnimationDriver_.clear();
+    runNativeAnimations_.reset();
+    mapperRegistry_.clear();
+    runMappers_.reset();
+#ifdef RCT_NEW_ARCH_ENABLED
+    propsShapeCache_.clear();
+#endif
     runtimeManager_->runtime.reset();
     // make sure uiRuntimeDestroyed is set after the runtime is deallocated
     runtimeHelper->uiRuntimeDestroyed = true;
@@ -193,17 +340,19 @@ void NativeReanimatedModule::scheduleOnUI(
     const jsi::Value &worklet) {
   auto shareableWorklet = extractShareableOrThrow<ShareableWorklet>(
       rt, worklet, "only worklets can be scheduled to run on UI");
-  runtimeManager_->uiScheduler_->scheduleOnUI([=] {
-    jsi::Runtime &rt = *runtimeHelper->uiRuntime();
-    auto workletValue = shareableWorklet->getJSValue(rt);
-    runtimeHelper->runOnUIGuarded(workletValue);
-  });
+  runtimeManager_->uiScheduler_->scheduleOnUI(
+      [this, shareableWorklet = std::move(shareableWorklet)] {
+        jsi::Runtime &rt = *runtimeHelper->uiRuntime();
+        auto workletValue = shareableWorklet->getJSValue(rt);
+        runtimeHelper->runOnUIGuarded(workletValue);
+      });
 }
 
 void NativeReanimatedModule::scheduleOnJS(
     jsi::Runtime &rt,
     const jsi::Value &remoteFun,
-    const jsi::Value &argsValue) {
+    const jsi::Value &argsValue,
+    bool latestWins) {
   auto shareableRemoteFun = extractShareableOrThrow<ShareableRemoteFunction>(
       rt,
       remoteFun,
@@ -213,24 +362,138 @@ void NativeReanimatedModule::scheduleOnJS(
       : extractShareableOrThrow<ShareableArray>(
             rt, argsValue, "args must be an array");
   auto jsRuntime = this->runtimeHelper->rnRuntime();
-  runtimeManager_->jsScheduler_->scheduleOnJS([=] {
-    jsi::Runtime &rt = *jsRuntime;
-    auto remoteFun = shareableRemoteFun->getJSValue(rt);
-    if (shareableArgs == nullptr) {
-      // fast path for remote function w/o arguments
-      remoteFun.asObject(rt).asFunction(rt).call(rt);
-    } else {
-      auto argsArray = shareableArgs->getJSValue(rt).asObject(rt).asArray(rt);
-      auto argsSize = argsArray.size(rt);
-      // number of arguments is typically relatively small so it is ok to
-      // to use VLAs here, hence disabling the lint rule
-      jsi::Value args[argsSize]; // NOLINT(runtime/arrays)
-      for (size_t i = 0; i < argsSize; i++) {
-        args[i] = argsArray.getValueAtIndex(rt, i);
-      }
-      remoteFun.asObject(rt).asFunction(rt).call(rt, args, argsSize);
-    }
-  });
+  // For "latest wins" calls only the last call of a given remote function
+  // within a UI tick reaches the JS thread.
+  const void *latestWinsKey = latestWins ? shareableRemoteFun.get() : nullptr;
+  UniqueFunction<void()> job =
+      [jsRuntime,
+       shareableRemoteFun = std::move(shareableRemoteFun),
+       shareableArgs = std::move(shareableArgs)] {
+        jsi::Runtime &rt = *jsRuntime;
+        auto remoteFun = shareableRemoteFun->getJSValue(rt);
+        if (shareableArgs == nullptr) {
+          // fast path for remote function w/o arguments
+          remoteFun.asObject(rt).asFunction(rt).call(rt);
+        } else {
+          auto argsArray =
+              shareableArgs->getJSValue(rt).asObject(rt).asArray(rt);
+          auto argsSize = argsArray.size(rt);
+          // number of arguments is typically relatively small so it is ok to
+          // to use VLAs here, hence disabling the lint rule
+          jsi::Value args[argsSize]; // NOLINT(runtime/arrays)
+          for (size_t i = 0; i < argsSize; i++) {
+            args[i] = argsArray.getValueAtIndex(rt, i);
+          }
+          remoteFun.asObject(rt).asFunction(rt).call(rt, args, argsSize);
+        }
+      };
+  if (runtimeHelper->isUIRuntime(rt)) {
+    runtimeManager_->jsScheduler_->scheduleBatchedOnJS(
+        std::move(job), latestWinsKey);
+  } else {
+    // called from a background runtime
+    runtimeManager_->jsScheduler_->scheduleOnJS(std::move(job));
+  }
+}
+
+void NativeReanimatedModule::startBackgroundRuntimes(
+    jsi::Runtime &rt,
+    const jsi::Value &count,
+    const jsi::Value &initializer) {
+  if (workletRuntimePool_ != nullptr) {
+    return;
+  }
+  // every runtime takes a slot in the runtime registry of RuntimeDecorator
+  constexpr double kMaxBackgroundRuntimes = 16;
+  size_t size = count.isNumber() && count.asNumber() >= 1
+      ? static_cast<size_t>(std::min(count.asNumber(), kMaxBackgroundRuntimes))
+      : std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+  auto shareableInitializer = initializer.isUndefined()
+      ? nullptr
+      : extractShareableOrThrow<ShareableWorklet>(
+            rt, initializer, "initializer must be a worklet");
+
+  auto scheduleOnJS = [this](
+                          jsi::Runtime &rt,
+                          const jsi::Value &remoteFun,
+                          const jsi::Value &argsValue,
+                          const jsi::Value &) {
+    this->scheduleOnJS(rt, remoteFun, argsValue);
+  };
+
+  auto makeShareableClone = [this](jsi::Runtime &rt, const jsi::Value &value) {
+    return this->makeShareableClone(rt, value, jsi::Value::undefined());
+  };
+
+  runtimeHelper->backgroundRuntimesStarted = true;
+  workletRuntimePool_ = std::make_unique<WorkletRuntimePool>(
+      size,
+      &rt,
+      runtimeHelper,
+      [scheduleOnJS,
+       makeShareableClone,
+       shareableInitializer = std::move(shareableInitializer)](
+          jsi::Runtime &rt, const std::string &label) {
+        RuntimeDecorator::decorateBackgroundRuntime(
+            rt, label, scheduleOnJS, makeShareableClone);
+        if (shareableInitializer != nullptr) {
+          shareableInitializer->getJSValue(rt).asObject(rt).asFunction(rt).call(
+              rt);
+        }
+      });
+}
+
+void NativeReanimatedModule::scheduleOnBackground(
+    jsi::Runtime &rt,
+    const jsi::Value &worklet,
+    const jsi::Value &onResult) {
+  if (workletRuntimePool_ == nullptr) {
+    throw std::runtime_error(
+        "[Reanimated] Background runtimes haven't been started yet.");
+  }
+  auto shareableWorklet = extractShareableOrThrow<ShareableWorklet>(
+      rt,
+      worklet,
+      "Only worklets can be scheduled to run on a background runtime.");
+  auto shareableOnResult =
+      onResult.isUndefined() ? nullptr : extractShareableOrThrow(rt, onResult);
+
+  workletRuntimePool_->schedule(
+      [runtimeHelper = runtimeHelper,
+       shareableWorklet = std::move(shareableWorklet),
+       shareableOnResult = std::move(shareableOnResult)](jsi::Runtime &rt) {
+        auto result =
+            shareableWorklet->getJSValue(rt).asObject(rt).asFunction(rt).call(
+                rt);
+        if (shareableOnResult == nullptr) {
+          return;
+        }
+        // the worklet returns its result already converted to a shareable
+        auto shareableResult = extractShareableOrThrow(
+            rt, result, "result of a background worklet must be a shareable");
+        if (shareableOnResult->valueType() == Shareable::WorkletType) {
+          runtimeHelper->scheduleOnUI(
+              [runtimeHelper,
+               shareableOnResult = std::move(shareableOnResult),
+               shareableResult = std::move(shareableResult)] {
+                jsi::Runtime &rt = *runtimeHelper->uiRuntime();
+                auto onResultValue = shareableOnResult->getJSValue(rt);
+                runtimeHelper->runOnUIGuarded(
+                    onResultValue, shareableResult->getJSValue(rt));
+              });
+        } else {
+          runtimeHelper->scheduleOnJS(
+              [runtimeHelper,
+               shareableOnResult = std::move(shareableOnResult),
+               shareableResult = std::move(shareableResult)] {
+                jsi::Runtime &rt = *runtimeHelper->rnRuntime();
+                shareableOnResult->getJSValue(rt)
+                    .asObject(rt)
+                    .asFunction(rt)
+                    .call(rt, shareableResult->getJSValue(rt));
+              });
+        }
+      });
 }
 
 jsi::Value NativeReanimatedModule::makeSynchronizedDataHolder(
@@ -324,7 +587,9 @@ jsi::Value NativeReanimatedModule::registerEventHandler(
     jsi::Runtime &rt,
     const jsi::Value &worklet,
     const jsi::Value &eventName,
-    const jsi::Value &emitterReactTag) {
+    const jsi::Value &emitterReactTag,
+    const jsi::Value &shouldConsumeEvent,
+    const jsi::Value &shouldCoalesceEvents) {
   static uint64_t NEXT_EVENT_HANDLER_ID = 1;
 
   uint64_t newRegistrationId = NEXT_EVENT_HANDLER_ID++;
@@ -332,18 +597,33 @@ jsi::Value NativeReanimatedModule::registerEventHandler(
   auto handlerShareable = extractShareableOrThrow<ShareableWorklet>(
       rt, worklet, "event handler must be a worklet");
   int emitterReactTagInt = emitterReactTag.asNumber();
+  bool shouldConsumeEventBool = shouldConsumeEvent.isBool() &&
+      shouldConsumeEvent.getBool();
+  bool shouldCoalesceEventsBool = shouldCoalesceEvents.isBool() &&
+      shouldCoalesceEvents.getBool();
 
-  runtimeManager_->uiScheduler_->scheduleOnUI([=] {
-    jsi::Runtime &rt = *runtimeHelper->uiRuntime();
-    auto handlerFunction = handlerShareable->getJSValue(rt);
-    auto handler = std::make_shared<WorkletEventHandler>(
-        runtimeHelper,
-        newRegistrationId,
-        eventNameStr,
-        emitterReactTagInt,
-        std::move(handlerFunction));
-    eventHandlerRegistry->registerEventHandler(std::move(handler));
-  });
+  runtimeManager_->uiScheduler_->scheduleOnUI(
+      [this,
+       newRegistrationId,
+       emitterReactTagInt,
+       shouldConsumeEventBool,
+       shouldCoalesceEventsBool,
+       eventNameStr = std::move(eventNameStr),
+       handlerShareable = std::move(handlerShareable)] {
+        jsi::Runtime &rt = *runtimeHelper->uiRuntime();
+        auto handlerFunction = handlerShareable->getJSValue(rt);
+        auto handler = std::make_shared<WorkletEventHandler>(
+            runtimeHelper,
+            newRegistrationId,
+            eventNameStr,
+            emitterReactTagInt,
+            shouldConsumeEventBool,
+            shouldCoalesceEventsBool,
+            std::move(handlerFunction));
+        eventHandlerRegistry->registerEventHandler(std::move(handler));
+        requestRetiredRoutingsCollection();
+      },
+      UIJobPriority::Deferrable);
 
   return jsi::Value(static_cast<double>(newRegistrationId));
 }
@@ -353,7 +633,81 @@ void NativeReanimatedModule::unregisterEventHandler(
     const jsi::Value &registrationId) {
   uint64_t id = registrationId.asNumber();
   runtimeManager_->uiScheduler_->scheduleOnUI(
-      [=] { eventHandlerRegistry->unregisterEventHandler(id); });
+      [=] {
+        eventHandlerRegistry->unregisterEventHandler(id);
+        requestRetiredRoutingsCollection();
+      },
+      UIJobPriority::Deferrable);
+}
+
+void NativeReanimatedModule::requestRetiredRoutingsCollection() {
+  if (retiredRoutingsFrameRequested_ ||
+      !eventHandlerRegistry->hasRetiredRoutings()) {
+    return;
+  }
+  // retried on the next frame while lookups from other threads keep them
+  retiredRoutingsFrameRequested_ = true;
+  frameCallbackRegistry_.requestFrame([this](double) {
+    retiredRoutingsFrameRequested_ = false;
+    eventHandlerRegistry->collectRetiredRoutings();
+    requestRetiredRoutingsCollection();
+  });
+  maybeRequestRender();
+}
+
+jsi::Value NativeReanimatedModule::registerFrameCallback(
+    jsi::Runtime &rt,
+    const jsi::Value &worklet) {
+  auto callbackShareable = extractShareableOrThrow<ShareableWorklet>(
+      rt, worklet, "frame callback must be a worklet");
+  auto callbackId = frameCallbackRegistry_.reserveId();
+
+  runtimeManager_->uiScheduler_->scheduleOnUI(
+      [this, callbackId, callbackShareable = std::move(callbackShareable)] {
+        jsi::Runtime &rt = *runtimeHelper->uiRuntime();
+        frameCallbackRegistry_.registerCallback(
+            callbackId,
+            [this, callback = callbackShareable->getJSValue(rt)](
+                const FrameInfo &frameInfo) {
+              jsi::Runtime &rt = *runtimeHelper->uiRuntime();
+              jsi::Object frameInfoObject(rt);
+              frameInfoObject.setProperty(
+                  rt, "timestamp", frameInfo.timestamp);
+              frameInfoObject.setProperty(
+                  rt,
+                  "timeSincePreviousFrame",
+                  frameInfo.timeSincePreviousFrame.has_value()
+                      ? jsi::Value(*frameInfo.timeSincePreviousFrame)
+                      : jsi::Value::null());
+              frameInfoObject.setProperty(
+                  rt, "timeSinceFirstFrame", frameInfo.timeSinceFirstFrame);
+              runtimeHelper->runOnUIGuarded(callback, frameInfoObject);
+            });
+      });
+
+  return jsi::Value(static_cast<double>(callbackId));
+}
+
+void NativeReanimatedModule::unregisterFrameCallback(
+    jsi::Runtime &,
+    const jsi::Value &callbackId) {
+  FrameCallbackId id = callbackId.asNumber();
+  runtimeManager_->uiScheduler_->scheduleOnUI(
+      [this, id] { frameCallbackRegistry_.unregisterCallback(id); });
+}
+
+void NativeReanimatedModule::setFrameCallbackActive(
+    jsi::Runtime &,
+    const jsi::Value &callbackId,
+    const jsi::Value &isActive) {
+  FrameCallbackId id = callbackId.asNumber();
+  bool active = isActive.getBool();
+  runtimeManager_->uiScheduler_->scheduleOnUI([this, id, active] {
+    frameCallbackRegistry_.setActive(id, active);
+    if (active) {
+      maybeRequestRender();
+    }
+  });
 }
 
 jsi::Value NativeReanimatedModule::getViewProp(
@@ -368,7 +722,11 @@ jsi::Value NativeReanimatedModule::getViewProp(
       std::make_shared<jsi::Function>(std::move(fun));
 
   runtimeManager_->uiScheduler_->scheduleOnUI(
-      [&rnRuntime, viewTagInt, funPtr, this, propNameStr]() {
+      [&rnRuntime,
+       viewTagInt,
+       this,
+       funPtr = std::move(funPtr),
+       propNameStr = std::move(propNameStr)]() mutable {
         jsi::Runtime &uiRuntime = *runtimeManager_->runtime;
         const jsi::String propNameValue =
             jsi::String::createFromUtf8(uiRuntime, propNameStr);
@@ -377,7 +735,9 @@ jsi::Value NativeReanimatedModule::getViewProp(
         std::string resultStr = result.asString(uiRuntime).utf8(uiRuntime);
 
         runtimeManager_->jsScheduler_->scheduleOnJS(
-            [&rnRuntime, resultStr, funPtr]() {
+            [&rnRuntime,
+             resultStr = std::move(resultStr),
+             funPtr = std::move(funPtr)]() {
               const jsi::String resultValue =
                   jsi::String::createFromUtf8(rnRuntime, resultStr);
               funPtr->call(rnRuntime, resultValue);
@@ -399,12 +759,15 @@ jsi::Value NativeReanimatedModule::configureProps(
     const jsi::Value &uiProps,
     const jsi::Value &nativeProps) {
 #ifdef RCT_NEW_ARCH_ENABLED
-  (void)uiProps; // unused variable on Fabric
-  jsi::Array array = nativeProps.asObject(rt).asArray(rt);
-  for (size_t i = 0; i < array.size(rt); ++i) {
-    std::string name = array.getValueAtIndex(rt, i).asString(rt).utf8(rt);
-    nativePropNames_.insert(name);
-  }
+  auto configure = [&](const jsi::Value &propNames, PropKind kind) {
+    jsi::Array array = propNames.asObject(rt).asArray(rt);
+    for (size_t i = 0, size = array.size(rt); i < size; ++i) {
+      propNameTable_.configure(
+          array.getValueAtIndex(rt, i).asString(rt).utf8(rt), kind);
+    }
+  };
+  configure(uiProps, kUIProp);
+  configure(nativeProps, kNativeProp);
 #else
   configurePropsPlatformFunction(rt, uiProps, nativeProps);
 #endif // RCT_NEW_ARCH_ENABLED
@@ -441,11 +804,65 @@ void NativeReanimatedModule::maybeRequestRender() {
   }
 }
 
+jsi::Value NativeReanimatedModule::getFrameTimingTrace(jsi::Runtime &rt) {
+  return jsi::String::createFromUtf8(rt, frameTimingRecorder_->toTraceJSON());
+}
+
+jsi::Value NativeReanimatedModule::getPropsUpdateStats(jsi::Runtime &rt) {
+  jsi::Object result(rt);
+#ifdef RCT_NEW_ARCH_ENABLED
+  const auto stats = propsUpdateFilter_.getStats();
+  result.setProperty(rt, "sentProps", static_cast<double>(stats.sentProps));
+  result.setProperty(
+      rt, "suppressedProps", static_cast<double>(stats.suppressedProps));
+  result.setProperty(
+      rt, "suppressedUpdates", static_cast<double>(stats.suppressedUpdates));
+  result.setProperty(rt, "propsUpdates", static_cast<double>(propsUpdates_));
+  result.setProperty(
+      rt, "jsiPropsConversions", static_cast<double>(stats.jsiConversions));
+  result.setProperty(
+      rt, "rawPropsConversions", static_cast<double>(rawPropsConversions_));
+  const auto pathStats = ancestorPathCache_.getStats();
+  result.setProperty(
+      rt, "ancestorPathHits", static_cast<double>(pathStats.hits));
+  result.setProperty(
+      rt, "ancestorPathMisses", static_cast<double>(pathStats.misses));
+#else
+  // updates aren't filtered on Paper
+  result.setProperty(rt, "sentProps", 0);
+  result.setProperty(rt, "suppressedProps", 0);
+  result.setProperty(rt, "suppressedUpdates", 0);
+  result.setProperty(rt, "propsUpdates", 0);
+  result.setProperty(rt, "jsiPropsConversions", 0);
+  result.setProperty(rt, "rawPropsConversions", 0);
+  result.setProperty(rt, "ancestorPathHits", 0);
+  result.setProperty(rt, "ancestorPathMisses", 0);
+#endif
+  return result;
+}
+
+void NativeReanimatedModule::setPropsUpdateEpsilon(
+    jsi::Runtime &,
+    const jsi::Value &epsilon) {
+#ifdef RCT_NEW_ARCH_ENABLED
+  propsUpdateFilter_.setEpsilon(epsilon.asNumber());
+#endif
+}
+
 void NativeReanimatedModule::onRender(double timestampMs) {
-  std::vector<FrameCallback> callbacks = frameCallbacks;
-  frameCallbacks.clear();
-  for (auto &callback : callbacks) {
-    callback(timestampMs);
+  frameTimingRecorder_->setCurrentThreadName("Reanimated UI");
+  FrameTimingScope frameTiming(frameTimingRecorder_.get(), FramePhase::Frame);
+  JSScheduler::BatchScope jsBatch(runtimeManager_->jsScheduler_.get());
+  if (nativeAnimationDriver_.hasRunningAnimations()) {
+    runtimeHelper->runOnUIGuarded(
+        *runNativeAnimations_, jsi::Value(timestampMs));
+  }
+  frameTiming.setCount(frameCallbackRegistry_.runFrame(timestampMs));
+  if (frameCallbackRegistry_.hasPendingCallbacks() ||
+      nativeAnimationDriver_.hasRunningAnimations()) {
+    // active frame callbacks and native animations run on every frame until
+    // they are deactivated or finish
+    maybeRequestRender();
   }
 }
 
@@ -474,39 +891,31 @@ void NativeReanimatedModule::cleanupSensors() {
   animatedSensorModule.unregisterAllSensors();
 }
 
-#ifdef RCT_NEW_ARCH_ENABLED
-bool NativeReanimatedModule::isThereAnyLayoutProp(
-    jsi::Runtime &rt,
-    const jsi::Object &props) {
-  const jsi::Array propNames = props.getPropertyNames(rt);
-  for (size_t i = 0; i < propNames.size(rt); ++i) {
-    const std::string propName =
-        propNames.getValueAtIndex(rt, i).asString(rt).utf8(rt);
-    bool isLayoutProp =
-        nativePropNames_.find(propName) != nativePropNames_.end();
-    if (isLayoutProp) {
-      return true;
-    }
-  }
-  return false;
-}
-#endif // RCT_NEW_ARCH_ENABLED
-
-bool NativeReanimatedModule::handleEvent(
+EventHandlingResult NativeReanimatedModule::handleEvent(
     const std::string &eventName,
     const int emitterReactTag,
     const jsi::Value &payload,
     double currentTime) {
-  eventHandlerRegistry->processEvent(
+  FrameTimingScope eventTiming(frameTimingRecorder_.get(), FramePhase::Event);
+  JSScheduler::BatchScope jsBatch(runtimeManager_->jsScheduler_.get());
+  const auto result = eventHandlerRegistry->processEvent(
       *runtimeManager_->runtime,
       currentTime,
       eventName,
       emitterReactTag,
       payload);
 
-  // TODO: return true if Reanimated successfully handled the event
-  // to avoid sending it to JavaScript
-  return false;
+  if (eventHandlerRegistry->hasCoalescedEvents() &&
+      !coalescedEventsFrameRequested_) {
+    // the coalescing handlers run once, on the next frame
+    coalescedEventsFrameRequested_ = true;
+    frameCallbackRegistry_.requestFrame([this](double) {
+      coalescedEventsFrameRequested_ = false;
+      eventHandlerRegistry->flushCoalescedEvents(*runtimeManager_->runtime);
+    });
+    maybeRequestRender();
+  }
+  return result;
 }
 
 #ifdef RCT_NEW_ARCH_ENABLED
@@ -532,13 +941,14 @@ bool NativeReanimatedModule::handleRawEvent(
   jsi::Runtime &rt = *runtimeManager_->runtime.get();
   jsi::Value payload = payloadFactory(rt);
 
-  auto res = handleEvent(eventType, tag, std::move(payload), currentTime);
-  // TODO: we should call performOperations conditionally if event is handled
-  // (res == true), but for now handleEvent always returns false. Thankfully,
-  // performOperations does not trigger a lot of code if there is nothing to be
-  // done so this is fine for now.
-  performOperations();
-  return res;
+  const auto result =
+      handleEvent(eventType, tag, std::move(payload), currentTime);
+  if (result.ranWorklets) {
+    // otherwise there are no updates to perform, coalesced events are
+    // handled on the next frame
+    performOperations();
+  }
+  return result.consumed;
 }
 
 void NativeReanimatedModule::updateProps(
@@ -550,12 +960,33 @@ void NativeReanimatedModule::updateProps(
     auto item = array.getValueAtIndex(rt, i).asObject(rt);
     auto shadowNodeWrapper = item.getProperty(rt, "shadowNodeWrapper");
     auto shadowNode = shadowNodeFromValue(rt, shadowNodeWrapper);
-    const jsi::Value &updates = item.getProperty(rt, "updates");
-    operationsInBatch_.emplace_back(
-        shadowNode, std::make_unique<jsi::Value>(rt, updates));
-
-    // TODO: support multiple surfaces
-    surfaceId_ = shadowNode->getSurfaceId();
+    const auto updates = item.getProperty(rt, "updates").asObject(rt);
+    const Tag tag = shadowNode->getTag();
+    const auto &shape =
+        propsShapeCache_.getShape(rt, propNameTable_, tag, updates);
+    uint8_t kinds;
+    auto props = propsUpdateFilter_.filter(rt, tag, shape, updates, kinds);
+    if (props.empty()) {
+      // nothing changed since the last update
+      continue;
+    }
+    // on Fabric, the native props are the ones that need a commit
+    const bool hasLayoutProps = (kinds & kNativeProp) != 0;
+
+    // A view driven by several animated styles, or updated by several mapper
+    // runs, may be updated many times before the batch is flushed. Later props
+    // win, same as if the updates were applied one by one.
+    const auto [it, isNewTag] =
+        operationsInBatchIndices_.try_emplace(tag, operationsInBatch_.size());
+    if (isNewTag) {
+      operationsInBatch_.push_back(
+          PropsUpdate{shadowNode, std::move(props), hasLayoutProps});
+    } else {
+      auto &update = operationsInBatch_[it->second];
+      update.shadowNode = shadowNode;
+      update.props.update(props);
+      update.hasLayoutProps |= hasLayoutProps;
+    }
   }
 }
 
@@ -566,96 +997,164 @@ void NativeReanimatedModule::performOperations() {
   }
 
   auto copiedOperationsQueue = std::move(operationsInBatch_);
-  operationsInBatch_ =
-      std::vector<std::pair<ShadowNode::Shared, std::unique_ptr<jsi::Value>>>();
+  operationsInBatch_ = std::vector<PropsUpdate>();
+  operationsInBatchIndices_.clear();
 
-  jsi::Runtime &rt = *runtimeManager_->runtime;
+  FrameTimingScope operationsTiming(
+      frameTimingRecorder_.get(), FramePhase::PerformOperations);
+  operationsTiming.setCount(copiedOperationsQueue.size());
+  propsUpdates_ += copiedOperationsQueue.size();
 
-  {
-    auto lock = propsRegistry_->createLock();
+  jsi::Runtime &rt = *runtimeManager_->runtime;
 
-    // remove recently unmounted ShadowNodes from PropsRegistry
-    if (!tagsToRemove_.empty()) {
-      for (auto tag : tagsToRemove_) {
-        propsRegistry_->remove(tag);
-      }
-      tagsToRemove_.clear();
+  // remove recently unmounted ShadowNodes from PropsRegistry
+  if (!tagsToRemove_.empty()) {
+    for (auto tag : tagsToRemove_) {
+      propsRegistry_->remove(tag);
+      propsShapeCache_.remove(tag);
+      propsUpdateFilter_.remove(tag);
+      ancestorPathCache_.remove(tag);
     }
-
-    // Even if only non-layout props are changed, we need to store the update in
-    // PropsRegistry anyway so that React doesn't overwrite it in the next
-    // render. Currently, only opacity and transform are treated in a special
-    // way but backgroundColor, shadowOpacity etc. would get overwritten (see
-    // `_propKeysManagedByAnimated_DO_NOT_USE_THIS_IS_BROKEN`).
-    for (const auto &[shadowNode, props] : copiedOperationsQueue) {
-      propsRegistry_->update(shadowNode, dynamicFromValue(rt, *props));
+    if (layoutCommitScheduler_ != nullptr) {
+      layoutCommitScheduler_->remove(tagsToRemove_);
     }
+    tagsToRemove_.clear();
   }
 
-  bool hasLayoutUpdates = false;
-  for (const auto &[shadowNode, props] : copiedOperationsQueue) {
-    if (isThereAnyLayoutProp(rt, props->asObject(rt))) {
-      hasLayoutUpdates = true;
-      break;
-    }
+  // Even if only non-layout props are changed, we need to store the update in
+  // PropsRegistry anyway so that React doesn't overwrite it in the next
+  // render. Currently, only opacity and transform are treated in a special
+  // way but backgroundColor, shadowOpacity etc. would get overwritten (see
+  // `_propKeysManagedByAnimated_DO_NOT_USE_THIS_IS_BROKEN`).
+  for (const auto &update : copiedOperationsQueue) {
+    propsRegistry_->update(update.shadowNode, update.props);
+  }
+  // a single atomic swap, React commits read the previous snapshot until then
+  propsRegistry_->publish();
+
+  // Surfaces (e.g. modals or additional root views) are updated
+  // independently, a surface which can't be committed now doesn't hold back
+  // the others.
+  std::unordered_map<SurfaceId, std::vector<const PropsUpdate *>>
+      updatesBySurface;
+  for (const auto &update : copiedOperationsQueue) {
+    updatesBySurface[update.shadowNode->getSurfaceId()].push_back(&update);
   }
 
-  if (!hasLayoutUpdates) {
-    // If there's no layout props to be updated, we can apply the updates
-    // directly onto the components and skip the commit.
-    for (const auto &[shadowNode, props] : copiedOperationsQueue) {
-      Tag tag = shadowNode->getTag();
-      synchronouslyUpdateUIPropsFunction(rt, tag, props->asObject(rt));
+  for (const auto &[surfaceId, updates] : updatesBySurface) {
+    const bool hasLayoutUpdates = std::any_of(
+        updates.begin(), updates.end(), [](const PropsUpdate *update) {
+          return update->hasLayoutProps;
+        });
+
+    if (!hasLayoutUpdates) {
+      // If there's no layout props to be updated, we can apply the updates
+      // directly onto the components and skip the commit.
+      FrameTimingScope updateTiming(
+          frameTimingRecorder_.get(), FramePhase::SynchronousPropsUpdate);
+      updateTiming.setCount(updates.size());
+      for (const auto *update : updates) {
+        Tag tag = update->shadowNode->getTag();
+        synchronouslyUpdateUIPropsFunction(rt, tag, update->props);
+      }
+      continue;
+    }
+
+#if REANIMATED_ASYNC_LAYOUT_COMMIT
+    if (layoutCommitScheduler_ == nullptr) {
+      const auto &backgroundExecutor =
+          getBackgroundExecutorFromUIManager(*uiManager_);
+      if (backgroundExecutor) {
+        layoutCommitScheduler_ = std::make_shared<LayoutCommitScheduler>(
+            uiManager_,
+            propsRegistry_,
+            frameTimingRecorder_,
+            backgroundExecutor);
+      }
+    }
+    if (layoutCommitScheduler_ != nullptr) {
+      // Only the views with layout props wait for the commit, the others are
+      // updated right away.
+      std::vector<Tag> layoutTags;
+      FrameTimingScope updateTiming(
+          frameTimingRecorder_.get(), FramePhase::SynchronousPropsUpdate);
+      for (const auto *update : updates) {
+        Tag tag = update->shadowNode->getTag();
+        if (update->hasLayoutProps) {
+          layoutTags.push_back(tag);
+        } else {
+          synchronouslyUpdateUIPropsFunction(rt, tag, update->props);
+        }
+      }
+      updateTiming.setCount(updates.size() - layoutTags.size());
+      layoutCommitScheduler_->scheduleCommit(surfaceId, layoutTags);
+      continue;
+    }
+#endif // REANIMATED_ASYNC_LAYOUT_COMMIT
+
+    if (!commitPropsUpdates(surfaceId, updates)) {
+      // The commit will include the current values from PropsRegistry
+      // which will be applied in ReanimatedCommitHook.
+      for (const auto *update : updates) {
+        propsRegistry_->markUncommitted(
+            surfaceId, update->shadowNode->getTag());
+      }
     }
-    return;
   }
+}
 
-  if (propsRegistry_->shouldSkipCommit()) {
+bool NativeReanimatedModule::commitPropsUpdates(
+    SurfaceId surfaceId,
+    const std::vector<const PropsUpdate *> &updates) {
+  if (propsRegistry_->shouldSkipCommit(surfaceId)) {
     // It may happen that `performOperations` is called on the UI thread
     // while React Native tries to commit a new tree on the JS thread.
     // In this case, we should skip the commit here and let React Native do it.
-    // The commit will include the current values from PropsRegistry
-    // which will be applied in ReanimatedCommitHook.
-    return;
+    return false;
   }
 
   react_native_assert(uiManager_ != nullptr);
   const auto &shadowTreeRegistry = uiManager_->getShadowTreeRegistry();
 
-  shadowTreeRegistry.visit(surfaceId_, [&](ShadowTree const &shadowTree) {
+  FrameTimingScope commitTiming(frameTimingRecorder_.get(), FramePhase::Commit);
+  commitTiming.setCount(updates.size());
+
+  bool committed = true;
+  shadowTreeRegistry.visit(surfaceId, [&](ShadowTree const &shadowTree) {
     // Mark the commit as Reanimated commit so that we can distinguish it
     // in ReanimatedCommitHook.
     ReanimatedCommitMarker commitMarker;
 
-    shadowTree.commit(
+    const auto status = shadowTree.commit(
         [&](RootShadowNode const &oldRootShadowNode) {
+          FrameTimingScope cloneTiming(
+              frameTimingRecorder_.get(), FramePhase::CloneWithNewProps);
+          cloneTiming.setCount(updates.size());
+
           auto rootNode =
               oldRootShadowNode.ShadowNode::clone(ShadowNodeFragment{});
 
-          ShadowTreeCloner shadowTreeCloner{*uiManager_, surfaceId_};
-
-          for (const auto &[shadowNode, props] : copiedOperationsQueue) {
-            const ShadowNodeFamily &family = shadowNode->getFamily();
-            react_native_assert(family.getSurfaceId() == surfaceId_);
+          ShadowTreeCloner shadowTreeCloner{
+              *uiManager_, surfaceId, &ancestorPathCache_};
 
-            auto newRootNode = shadowTreeCloner.cloneWithNewProps(
-                rootNode, family, RawProps(rt, *props));
+          for (const auto *update : updates) {
+            const ShadowNodeFamily &family = update->shadowNode->getFamily();
+            react_native_assert(family.getSurfaceId() == surfaceId);
 
-            if (newRootNode == nullptr) {
-              // this happens when React removed the component but Reanimated
-              // still tries to animate it, let's skip update for this
-              // specific component
-              continue;
-            }
-            rootNode = newRootNode;
+            // copied, the commit may be retried
+            shadowTreeCloner.updateProps(family, RawProps(update->props));
           }
+          rawPropsConversions_ += updates.size();
 
-          auto newRoot = std::static_pointer_cast<RootShadowNode>(rootNode);
+          auto newRoot = std::static_pointer_cast<RootShadowNode>(
+              shadowTreeCloner.cloneWithNewProps(rootNode));
 
           return newRoot;
         },
         {/* default commit options */});
+    committed = status == ShadowTree::CommitStatus::Succeeded;
   });
+  return committed;
 }
 
 void NativeReanimatedModule::removeFromPropsRegistry(
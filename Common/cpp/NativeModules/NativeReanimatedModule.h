@@ -4,31 +4,38 @@
 #include <react/renderer/uimanager/UIManager.h>
 #endif
 
+#include <atomic>
 #include <memory>
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "AnimatedSensorModule.h"
+#include "EventHandlerRegistry.h"
+#include "FrameCallbackRegistry.h"
+#include "FrameTimingRecorder.h"
 #include "LayoutAnimationsManager.h"
+#include "MapperRegistry.h"
+#include "NativeAnimationDriver.h"
 #include "NativeReanimatedModuleSpec.h"
 #include "PlatformDepMethodsHolder.h"
+#include "PropNameTable.h"
 #include "RuntimeDecorator.h"
 #include "RuntimeManager.h"
 #include "SingleInstanceChecker.h"
 #include "UIScheduler.h"
+#include "WorkletRuntimePool.h"
 
 #ifdef RCT_NEW_ARCH_ENABLED
+#include "AncestorPathCache.h"
+#include "LayoutCommitScheduler.h"
 #include "PropsRegistry.h"
+#include "PropsUpdateFilter.h"
 #endif
 
 namespace reanimated {
 
-using FrameCallback = std::function<void(double)>;
-
-class EventHandlerRegistry;
-
 class NativeReanimatedModule : public NativeReanimatedModuleSpec {
  public:
   NativeReanimatedModule(
@@ -67,17 +74,38 @@ class NativeReanimatedModule : public NativeReanimatedModuleSpec {
   void scheduleOnJS(
       jsi::Runtime &rt,
       const jsi::Value &remoteFun,
-      const jsi::Value &argsValue);
+      const jsi::Value &argsValue,
+      bool latestWins = false);
+  void startBackgroundRuntimes(
+      jsi::Runtime &rt,
+      const jsi::Value &count,
+      const jsi::Value &initializer) override;
+  void scheduleOnBackground(
+      jsi::Runtime &rt,
+      const jsi::Value &worklet,
+      const jsi::Value &onResult) override;
 
   jsi::Value registerEventHandler(
       jsi::Runtime &rt,
       const jsi::Value &worklet,
       const jsi::Value &eventName,
-      const jsi::Value &emitterReactTag) override;
+      const jsi::Value &emitterReactTag,
+      const jsi::Value &shouldConsumeEvent,
+      const jsi::Value &shouldCoalesceEvents) override;
   void unregisterEventHandler(
       jsi::Runtime &rt,
       const jsi::Value &registrationId) override;
 
+  jsi::Value registerFrameCallback(jsi::Runtime &rt, const jsi::Value &worklet)
+      override;
+  void unregisterFrameCallback(
+      jsi::Runtime &rt,
+      const jsi::Value &callbackId) override;
+  void setFrameCallbackActive(
+      jsi::Runtime &rt,
+      const jsi::Value &callbackId,
+      const jsi::Value &isActive) override;
+
   jsi::Value getViewProp(
       jsi::Runtime &rt,
       const jsi::Value &viewTag,
@@ -97,6 +125,11 @@ class NativeReanimatedModule : public NativeReanimatedModuleSpec {
       const jsi::Value &sharedTransitionTag,
       const jsi::Value &config) override;
 
+  jsi::Value getFrameTimingTrace(jsi::Runtime &rt) override;
+  jsi::Value getPropsUpdateStats(jsi::Runtime &rt) override;
+  void setPropsUpdateEpsilon(jsi::Runtime &rt, const jsi::Value &epsilon)
+      override;
+
   void onRender(double timestampMs);
 
   bool isAnyHandlerWaitingForEvent(
@@ -106,13 +139,15 @@ class NativeReanimatedModule : public NativeReanimatedModuleSpec {
   void maybeRequestRender();
   UpdatePropsFunction updatePropsFunction;
 
-  bool handleEvent(
+  EventHandlingResult handleEvent(
       const std::string &eventName,
       const int emitterReactTag,
       const jsi::Value &payload,
       double currentTime);
 
 #ifdef RCT_NEW_ARCH_ENABLED
+  // Returns whether the event was consumed by Reanimated and doesn't have to
+  // be dispatched to React.
   bool handleRawEvent(const RawEvent &rawEvent, double currentTime);
 
   void updateProps(jsi::Runtime &rt, const jsi::Value &operations);
@@ -158,13 +193,42 @@ class NativeReanimatedModule : public NativeReanimatedModuleSpec {
 
  private:
 #ifdef RCT_NEW_ARCH_ENABLED
-  bool isThereAnyLayoutProp(jsi::Runtime &rt, const jsi::Object &props);
+  // Props update of a single view. The JS object is converted once, when the
+  // update is queued, and the registry, the commit and the direct update all
+  // use the result.
+  struct PropsUpdate {
+    ShadowNode::Shared shadowNode;
+    folly::dynamic props;
+    bool hasLayoutProps;
+  };
+
+  // Returns false if the updates weren't committed, e.g. because React is
+  // committing to the same surface right now.
+  bool commitPropsUpdates(
+      SurfaceId surfaceId,
+      const std::vector<const PropsUpdate *> &updates);
 #endif // RCT_NEW_ARCH_ENABLED
 
+  // UI thread only, after (un)registering event handlers.
+  void requestRetiredRoutingsCollection();
+
   std::unique_ptr<EventHandlerRegistry> eventHandlerRegistry;
   const RequestRenderFunction requestRender;
-  std::vector<FrameCallback> frameCallbacks;
+  FrameCallbackRegistry frameCallbackRegistry_;
+  NativeAnimationDriver nativeAnimationDriver_;
+  // Host function running `nativeAnimationDriver_`, called through the call
+  // guard so that errors thrown by JS are reported.
+  std::unique_ptr<jsi::Value> runNativeAnimations_;
+  MapperRegistry mapperRegistry_;
+  // Host function running the dirty mappers, scheduled with `queueMicrotask`
+  // or `requestAnimationFrame` on the UI runtime.
+  std::unique_ptr<jsi::Value> runMappers_;
+  std::shared_ptr<FrameTimingRecorder> frameTimingRecorder_ =
+      std::make_shared<FrameTimingRecorder>();
   bool renderRequested = false;
+  bool deferredUIJobsFrameRequested_ = false;
+  bool coalescedEventsFrameRequested_ = false;
+  bool retiredRoutingsFrameRequested_ = false;
   const ObtainPropFunction obtainPropFunction_;
   std::function<void(double)> onRenderCallback;
   AnimatedSensorModule animatedSensorModule;
@@ -175,21 +239,33 @@ class NativeReanimatedModule : public NativeReanimatedModuleSpec {
 
   std::shared_ptr<UIManager> uiManager_;
 
-  // After app reload, surfaceId on iOS is still 1 but on Android it's 11.
-  // We can store surfaceId of the most recent ShadowNode as a workaround.
-  SurfaceId surfaceId_ = -1;
-
-  std::vector<std::pair<ShadowNode::Shared, std::unique_ptr<jsi::Value>>>
-      operationsInBatch_; // TODO: refactor std::pair to custom struct
+  // at most one update per view, later updates are merged into it
+  std::vector<PropsUpdate> operationsInBatch_;
+  std::unordered_map<Tag, size_t> operationsInBatchIndices_;
 
   std::shared_ptr<PropsRegistry> propsRegistry_;
 
+  // created on first use, stays null if React Native has no background thread
+  std::shared_ptr<LayoutCommitScheduler> layoutCommitScheduler_;
+
   std::vector<Tag> tagsToRemove_; // from `propsRegistry_`
+
+  PropsShapeCache propsShapeCache_;
+  PropsUpdateFilter propsUpdateFilter_;
+  AncestorPathCache ancestorPathCache_; // for commits on the UI thread
+
+  // Together with the JSI conversions counted by `propsUpdateFilter_`, show
+  // how many times each update is converted, see `getPropsUpdateStats`.
+  std::atomic<uint64_t> propsUpdates_{0}; // run by `performOperations`
+  std::atomic<uint64_t> rawPropsConversions_{0}; // in `commitPropsUpdates`
 #endif
 
-  std::unordered_set<std::string> nativePropNames_; // filled by configureProps
+  PropNameTable propNameTable_; // filled by configureProps
   LayoutAnimationsManager layoutAnimationsManager_;
 
+  // created by `startBackgroundRuntimes`, only accessed from the JS thread
+  std::unique_ptr<WorkletRuntimePool> workletRuntimePool_;
+
   KeyboardEventSubscribeFunction subscribeForKeyboardEventsFunction;
   KeyboardEventUnsubscribeFunction unsubscribeFromKeyboardEventsFunction;
 
@@ -59,6 +59,26 @@ static jsi::Value SPEC_PREFIX(scheduleOnUI)(
   return jsi::Value::undefined();
 }
 
+static jsi::Value SPEC_PREFIX(startBackgroundRuntimes)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->startBackgroundRuntimes(rt, std::move(args[0]), std::move(args[1]));
+  return jsi::Value::undefined();
+}
+
+static jsi::Value SPEC_PREFIX(scheduleOnBackground)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->scheduleOnBackground(rt, std::move(args[0]), std::move(args[1]));
+  return jsi::Value::undefined();
+}
+
 static jsi::Value SPEC_PREFIX(registerEventHandler)(
     jsi::Runtime &rt,
     TurboModule &turboModule,
@@ -66,7 +86,12 @@ static jsi::Value SPEC_PREFIX(registerEventHandler)(
     size_t) {
   return static_cast<NativeReanimatedModuleSpec *>(&turboModule)
       ->registerEventHandler(
-          rt, std::move(args[0]), std::move(args[1]), std::move(args[2]));
+          rt,
+          std::move(args[0]),
+          std::move(args[1]),
+          std::move(args[2]),
+          std::move(args[3]),
+          std::move(args[4]));
 }
 
 static jsi::Value SPEC_PREFIX(unregisterEventHandler)(
@@ -79,6 +104,63 @@ static jsi::Value SPEC_PREFIX(unregisterEventHandler)(
   return jsi::Value::undefined();
 }
 
+static jsi::Value SPEC_PREFIX(registerFrameCallback)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  return static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->registerFrameCallback(rt, std::move(args[0]));
+}
+
+static jsi::Value SPEC_PREFIX(unregisterFrameCallback)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->unregisterFrameCallback(rt, std::move(args[0]));
+  return jsi::Value::undefined();
+}
+
+static jsi::Value SPEC_PREFIX(setFrameCallbackActive)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->setFrameCallbackActive(rt, std::move(args[0]), std::move(args[1]));
+  return jsi::Value::undefined();
+}
+
+static jsi::Value SPEC_PREFIX(getFrameTimingTrace)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *,
+    size_t) {
+  return static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->getFrameTimingTrace(rt);
+}
+
+static jsi::Value SPEC_PREFIX(getPropsUpdateStats)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *,
+    size_t) {
+  return static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->getPropsUpdateStats(rt);
+}
+
+static jsi::Value SPEC_PREFIX(setPropsUpdateEpsilon)(
+    jsi::Runtime &rt,
+    TurboModule &turboModule,
+    const jsi::Value *args,
+    size_t) {
+  static_cast<NativeReanimatedModuleSpec *>(&turboModule)
+      ->setPropsUpdateEpsilon(rt, std::move(args[0]));
+  return jsi::Value::undefined();
+}
+
 static jsi::Value SPEC_PREFIX(getViewProp)(
     jsi::Runtime &rt,
     TurboModule &turboModule,
@@ -182,12 +264,30 @@ NativeReanimatedModuleSpec::NativeReanimatedModuleSpec(
       MethodMetadata{1, SPEC_PREFIX(getDataSynchronously)};
 
   methodMap_["scheduleOnUI"] = MethodMetadata{1, SPEC_PREFIX(scheduleOnUI)};
+  methodMap_["startBackgroundRuntimes"] =
+      MethodMetadata{2, SPEC_PREFIX(startBackgroundRuntimes)};
+  methodMap_["scheduleOnBackground"] =
+      MethodMetadata{2, SPEC_PREFIX(scheduleOnBackground)};
 
   methodMap_["registerEventHandler"] =
-      MethodMetadata{3, SPEC_PREFIX(registerEventHandler)};
+      MethodMetadata{5, SPEC_PREFIX(registerEventHandler)};
   methodMap_["unregisterEventHandler"] =
       MethodMetadata{1, SPEC_PREFIX(unregisterEventHandler)};
 
+  methodMap_["registerFrameCallback"] =
+      MethodMetadata{1, SPEC_PREFIX(registerFrameCallback)};
+  methodMap_["unregisterFrameCallback"] =
+      MethodMetadata{1, SPEC_PREFIX(unregisterFrameCallback)};
+  methodMap_["setFrameCallbackActive"] =
+      MethodMetadata{2, SPEC_PREFIX(setFrameCallbackActive)};
+
+  methodMap_["getFrameTimingTrace"] =
+      MethodMetadata{0, SPEC_PREFIX(getFrameTimingTrace)};
+  methodMap_["getPropsUpdateStats"] =
+      MethodMetadata{0, SPEC_PREFIX(getPropsUpdateStats)};
+  methodMap_["setPropsUpdateEpsilon"] =
+      MethodMetadata{1, SPEC_PREFIX(setPropsUpdateEpsilon)};
+
   methodMap_["getViewProp"] = MethodMetadata{3, SPEC_PREFIX(getViewProp)};
   methodMap_["enableLayoutAnimations"] =
       MethodMetadata{2, SPEC_PREFIX(enableLayoutAnimations)};
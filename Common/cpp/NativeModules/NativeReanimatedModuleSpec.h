@@ -43,17 +43,46 @@ class JSI_EXPORT NativeReanimatedModuleSpec : public TurboModule {
 
   // Scheduling
   virtual void scheduleOnUI(jsi::Runtime &rt, const jsi::Value &worklet) = 0;
+  virtual void startBackgroundRuntimes(
+      jsi::Runtime &rt,
+      const jsi::Value &count,
+      const jsi::Value &initializer) = 0;
+  virtual void scheduleOnBackground(
+      jsi::Runtime &rt,
+      const jsi::Value &worklet,
+      const jsi::Value &onResult) = 0;
 
   // events
   virtual jsi::Value registerEventHandler(
       jsi::Runtime &rt,
       const jsi::Value &worklet,
       const jsi::Value &eventName,
-      const jsi::Value &emitterReactTag) = 0;
+      const jsi::Value &emitterReactTag,
+      const jsi::Value &shouldConsumeEvent,
+      const jsi::Value &shouldCoalesceEvents) = 0;
   virtual void unregisterEventHandler(
       jsi::Runtime &rt,
       const jsi::Value &registrationId) = 0;
 
+  // frame callbacks
+  virtual jsi::Value registerFrameCallback(
+      jsi::Runtime &rt,
+      const jsi::Value &worklet) = 0;
+  virtual void unregisterFrameCallback(
+      jsi::Runtime &rt,
+      const jsi::Value &callbackId) = 0;
+  virtual void setFrameCallbackActive(
+      jsi::Runtime &rt,
+      const jsi::Value &callbackId,
+      const jsi::Value &isActive) = 0;
+
+  // profiling
+  virtual jsi::Value getFrameTimingTrace(jsi::Runtime &rt) = 0;
+  virtual jsi::Value getPropsUpdateStats(jsi::Runtime &rt) = 0;
+  virtual void setPropsUpdateEpsilon(
+      jsi::Runtime &rt,
+      const jsi::Value &epsilon) = 0;
+
   // views
   virtual jsi::Value getViewProp(
       jsi::Runtime &rt,
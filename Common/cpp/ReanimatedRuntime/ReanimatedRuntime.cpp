@@ -53,4 +53,19 @@ std::shared_ptr<jsi::Runtime> ReanimatedRuntime::make(
 #endif
 }
 
+std::shared_ptr<jsi::Runtime> ReanimatedRuntime::makeBackground(
+    jsi::Runtime *rnRuntime) {
+  (void)rnRuntime; // used only for V8
+#if JS_RUNTIME_HERMES
+  return facebook::hermes::makeHermesRuntime();
+#elif JS_RUNTIME_V8
+  auto config = std::make_unique<rnv8::V8RuntimeConfig>();
+  config->enableInspector = false;
+  config->appName = "reanimated-background";
+  return rnv8::createSharedV8Runtime(rnRuntime, std::move(config));
+#else
+  return facebook::jsc::makeJSCRuntime();
+#endif
+}
+
 } // namespace reanimated
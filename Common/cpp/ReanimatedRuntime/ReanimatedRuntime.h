@@ -23,6 +23,10 @@ class ReanimatedRuntime {
   static std::shared_ptr<jsi::Runtime> make(
       jsi::Runtime *rnRuntime,
       std::shared_ptr<MessageQueueThread> jsQueue);
+
+  // Creates a runtime for a background worklet thread. Unlike the UI runtime
+  // it is not registered with the debugger.
+  static std::shared_ptr<jsi::Runtime> makeBackground(jsi::Runtime *rnRuntime);
 };
 
 } // namespace reanimated
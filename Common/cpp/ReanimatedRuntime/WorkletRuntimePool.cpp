@@ -0,0 +1,66 @@
+#include "WorkletRuntimePool.h"
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "ReanimatedRuntime.h"
+#include "RuntimeDecorator.h"
+
+namespace reanimated {
+
+WorkletRuntimePool::WorkletRuntimePool(
+    size_t size,
+    jsi::Runtime *rnRuntime,
+    const std::shared_ptr<JSRuntimeHelper> &runtimeHelper,
+    DecorateFunction decorate)
+    : rnRuntime_(rnRuntime),
+      runtimeHelper_(runtimeHelper),
+      decorate_(std::move(decorate)),
+      runtimes_(size),
+      executor_(
+          size,
+          [this](size_t index) { startRuntime(index); },
+          [this](size_t index) { stopRuntime(index); }) {}
+
+void WorkletRuntimePool::schedule(RuntimeJob job) {
+  executor_.submit([this, job = std::move(job)](size_t index) mutable {
+    jsi::Runtime &rt = *runtimes_[index];
+    try {
+      job(rt);
+    } catch (std::exception &e) {
+      reportError(e);
+    }
+  });
+}
+
+void WorkletRuntimePool::reportError(const std::exception &e) {
+  // There is no error handler on background runtimes, we report the error the
+  // same way an uncaught exception on the JS thread would be.
+  runtimeHelper_->scheduleOnJS(
+      [rnRuntime = rnRuntime_, message = std::string(e.what())] {
+        throw jsi::JSError(*rnRuntime, message);
+      });
+}
+
+void WorkletRuntimePool::startRuntime(size_t index) {
+  auto runtime = ReanimatedRuntime::makeBackground(rnRuntime_);
+  RuntimeDecorator::registerRuntime(runtime.get(), RuntimeType::Worklet);
+  try {
+    decorate_(*runtime, "Background #" + std::to_string(index + 1));
+  } catch (std::exception &e) {
+    reportError(e);
+  }
+  runtimes_[index] = std::move(runtime);
+}
+
+void WorkletRuntimePool::stopRuntime(size_t index) {
+  auto &runtime = runtimes_[index];
+  // JSI values tied to the runtime have to be released before it goes away.
+  runtimeHelper_->releaseRuntime(*runtime);
+  RuntimeDecorator::unregisterRuntime(runtime.get());
+  runtime.reset();
+}
+
+} // namespace reanimated
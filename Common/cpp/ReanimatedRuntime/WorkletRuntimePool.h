@@ -0,0 +1,60 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "JSRuntimeHelper.h"
+#include "UniqueFunction.h"
+#include "WorkStealingExecutor.h"
+
+using namespace facebook;
+
+namespace reanimated {
+
+/**
+ A set of background worklet runtimes, each living on its own thread. Jobs are
+ distributed between the threads by a work-stealing executor and run on the
+ runtime of the thread that picked them up. Runtimes are created, decorated and
+ destroyed on their threads.
+ */
+class WorkletRuntimePool {
+ public:
+  using RuntimeJob = UniqueFunction<void(jsi::Runtime &rt)>;
+  using DecorateFunction =
+      std::function<void(jsi::Runtime &rt, const std::string &label)>;
+
+  WorkletRuntimePool(
+      size_t size,
+      jsi::Runtime *rnRuntime,
+      const std::shared_ptr<JSRuntimeHelper> &runtimeHelper,
+      DecorateFunction decorate);
+
+  // Any thread. Exceptions thrown by the job are rethrown on the JS thread.
+  void schedule(RuntimeJob job);
+
+  inline size_t size() const {
+    return runtimes_.size();
+  }
+
+ private:
+  void startRuntime(size_t index);
+  void stopRuntime(size_t index);
+  void reportError(const std::exception &e);
+
+  jsi::Runtime *rnRuntime_;
+  std::shared_ptr<JSRuntimeHelper> runtimeHelper_;
+  DecorateFunction decorate_;
+  // Slot `i` is only accessed by the i-th worker thread.
+  std::vector<std::shared_ptr<jsi::Runtime>> runtimes_;
+  // Declared last so that the workers are joined before the members above go
+  // away.
+  WorkStealingExecutor executor_;
+};
+
+} // namespace reanimated
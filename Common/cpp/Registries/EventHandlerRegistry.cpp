@@ -1,92 +1,221 @@
 #include "EventHandlerRegistry.h"
 #include "WorkletEventHandler.h"
 
+#include <algorithm>
+#include <iterator>
 #include <utility>
 
 namespace reanimated {
 
+int EventHandlerRegistry::getRouteTag(const WorkletEventHandler &eventHandler) {
+  return eventHandler.shouldIgnoreEmitterReactTag()
+      ? kAnyEmitterReactTag
+      : static_cast<int>(eventHandler.getEmitterReactTag());
+}
+
+EventHandlerRegistry::OffThreadReadGuard::OffThreadReadGuard(
+    const EventHandlerRegistry &registry)
+    : registry_(registry) {
+  // Both seq_cst, so that `collectRetiredRoutings` either sees this reader or
+  // the reader sees the routing published before it.
+  ++registry_.offThreadReaders;
+  routing_ = registry_.publishedRouting.load();
+}
+
+EventHandlerRegistry::OffThreadReadGuard::~OffThreadReadGuard() {
+  --registry_.offThreadReaders;
+}
+
+void EventHandlerRegistry::publish(std::unique_ptr<const Routing> newRouting) {
+  publishedRouting = newRouting.get();
+  retiredRoutings.push_back(std::move(currentRouting));
+  currentRouting = std::move(newRouting);
+}
+
+void EventHandlerRegistry::collectRetiredRoutings() {
+  if (offThreadReaders == 0) {
+    // lookups which start from now on get the published routing
+    retiredRoutings.clear();
+  }
+}
+
 void EventHandlerRegistry::registerEventHandler(
     std::shared_ptr<WorkletEventHandler> eventHandler) {
-  const std::lock_guard<std::mutex> lock(instanceMutex);
+  auto newRouting = std::make_unique<Routing>(*currentRouting);
   const auto &eventName = eventHandler->getEventName();
   auto handlerId = eventHandler->getHandlerId();
 
-  if (eventHandler->shouldIgnoreEmitterReactTag()) {
-    eventMappingsWithoutTag[eventName][handlerId] = eventHandler;
-  } else {
-    const auto emitterReactTag = eventHandler->getEmitterReactTag();
-    const auto eventHash = std::make_pair(emitterReactTag, eventName);
-    eventMappingsWithTag[eventHash][handlerId] = eventHandler;
+  auto &eventIds = newRouting->eventIds;
+  const auto eventId =
+      eventIds.try_emplace(eventName, static_cast<EventId>(eventIds.size()))
+          .first->second;
+  auto &handlers =
+      newRouting->routes[getRouteKey(getRouteTag(*eventHandler), eventId)];
+  auto newHandlers = handlers != nullptr
+      ? std::make_shared<Handlers>(*handlers)
+      : std::make_shared<Handlers>();
+  const auto previousIt = eventHandlers.find(handlerId);
+  if (previousIt != eventHandlers.end()) {
+    // registered again under the same id, replaces the old handler
+    newHandlers->erase(
+        std::remove(
+            newHandlers->begin(), newHandlers->end(), previousIt->second),
+        newHandlers->end());
   }
+  newHandlers->push_back(eventHandler);
+  handlers = std::move(newHandlers);
   eventHandlers[handlerId] = eventHandler;
+  publish(std::move(newRouting));
 }
 
 void EventHandlerRegistry::unregisterEventHandler(uint64_t id) {
-  const std::lock_guard<std::mutex> lock(instanceMutex);
   auto handlerIt = eventHandlers.find(id);
-  if (handlerIt != eventHandlers.end()) {
-    const auto &eventHandler = handlerIt->second;
-    const auto &eventName = eventHandler->getEventName();
-
-    if (eventHandler->shouldIgnoreEmitterReactTag()) {
-      const auto eventMappingIt = eventMappingsWithoutTag.find(eventName);
-      auto &handlersMap = eventMappingIt->second;
-      handlersMap.erase(id);
-      if (handlersMap.empty()) {
-        eventMappingsWithoutTag.erase(eventMappingIt);
-      }
+  if (handlerIt == eventHandlers.end()) {
+    return;
+  }
+  auto newRouting = std::make_unique<Routing>(*currentRouting);
+  const auto &eventHandler = handlerIt->second;
+  const auto eventId = newRouting->eventIds.at(eventHandler->getEventName());
+  const auto routeIt =
+      newRouting->routes.find(getRouteKey(getRouteTag(*eventHandler), eventId));
+  if (routeIt != newRouting->routes.end()) {
+    auto newHandlers = std::make_shared<Handlers>();
+    newHandlers->reserve(routeIt->second->size());
+    std::copy_if(
+        routeIt->second->begin(),
+        routeIt->second->end(),
+        std::back_inserter(*newHandlers),
+        [&](const auto &handler) { return handler != eventHandler; });
+    if (newHandlers->empty()) {
+      newRouting->routes.erase(routeIt);
     } else {
-      const auto emitterReactTag = eventHandler->getEmitterReactTag();
-      const auto eventHash = std::make_pair(emitterReactTag, eventName);
-      const auto eventMappingIt = eventMappingsWithTag.find(eventHash);
-      auto &handlersMap = eventMappingIt->second;
-      handlersMap.erase(id);
-      if (handlersMap.empty()) {
-        eventMappingsWithTag.erase(eventMappingIt);
-      }
+      routeIt->second = std::move(newHandlers);
     }
-    eventHandlers.erase(handlerIt);
   }
+  eventHandlers.erase(handlerIt);
+  publish(std::move(newRouting));
 }
 
-void EventHandlerRegistry::processEvent(
+EventHandlingResult EventHandlerRegistry::processEvent(
     jsi::Runtime &rt,
     double eventTimestamp,
     const std::string &eventName,
     const int emitterReactTag,
     const jsi::Value &eventPayload) {
-  std::vector<std::shared_ptr<WorkletEventHandler>> handlersForEvent;
-  {
-    const std::lock_guard<std::mutex> lock(instanceMutex);
-    auto handlersIt = eventMappingsWithoutTag.find(eventName);
-    if (handlersIt != eventMappingsWithoutTag.end()) {
-      for (auto handler : handlersIt->second) {
-        handlersForEvent.push_back(handler.second);
-      }
-    }
-    const auto eventHash = std::make_pair(emitterReactTag, eventName);
-    auto handlersWithTagIt = eventMappingsWithTag.find(eventHash);
-    if (handlersWithTagIt != eventMappingsWithTag.end()) {
-      for (auto handler : handlersWithTagIt->second) {
-        handlersForEvent.push_back(handler.second);
-      }
-    }
+  // keeps the handlers alive even if they are unregistered meanwhile
+  const auto &[eventIds, routes] = loadRouting();
+  const auto eventIdIt = eventIds.find(eventName);
+  if (eventIdIt == eventIds.end()) {
+    return {};
+  }
+  const auto eventId = eventIdIt->second;
+  const auto handlersWithoutTagIt =
+      routes.find(getRouteKey(kAnyEmitterReactTag, eventId));
+  const auto handlersWithTagIt =
+      routes.find(getRouteKey(emitterReactTag, eventId));
+  if (handlersWithoutTagIt == routes.end() &&
+      handlersWithTagIt == routes.end()) {
+    return {};
+  }
+
+  EventHandlingResult result{true, false};
+  if (!WorkletEventHandler::isContinuousEvent(eventName)) {
+    result.ranWorklets = flushEmitterCoalescedEvents(rt, emitterReactTag);
   }
 
   eventPayload.asObject(rt).setProperty(
       rt, "eventName", jsi::String::createFromUtf8(rt, eventName));
-  for (auto handler : handlersForEvent) {
-    handler->process(eventTimestamp, eventPayload);
+  for (const auto &it : {handlersWithoutTagIt, handlersWithTagIt}) {
+    if (it == routes.end()) {
+      continue;
+    }
+    for (const auto &handler : *it->second) {
+      result.consumed &= handler->shouldConsumeEvent();
+      if (!handler->shouldCoalesceEvents()) {
+        handler->process(eventTimestamp, eventPayload);
+        result.ranWorklets = true;
+        continue;
+      }
+      auto coalescedIt = std::find_if(
+          coalescedEvents.begin(),
+          coalescedEvents.end(),
+          [&](const CoalescedEvent &event) {
+            return event.handler == handler &&
+                event.emitterReactTag == emitterReactTag;
+          });
+      if (coalescedIt == coalescedEvents.end()) {
+        coalescedEvents.push_back(CoalescedEvent{
+            handler,
+            emitterReactTag,
+            eventTimestamp,
+            jsi::Value(rt, eventPayload),
+            0});
+      } else {
+        // the latest event already carries the latest position and velocity
+        coalescedIt->eventTimestamp = eventTimestamp;
+        coalescedIt->payload = jsi::Value(rt, eventPayload);
+        ++coalescedIt->droppedEventsCount;
+      }
+    }
   }
+  return result;
 }
 
 bool EventHandlerRegistry::isAnyHandlerWaitingForEvent(
     const std::string &eventName,
     const int emitterReactTag) {
-  const std::lock_guard<std::mutex> lock(instanceMutex);
-  const auto eventHash = std::make_pair(emitterReactTag, eventName);
-  auto it = eventMappingsWithTag.find(eventHash);
-  return it != eventMappingsWithTag.end() && !it->second.empty();
+  const OffThreadReadGuard guard(*this);
+  const auto &[eventIds, routes] = guard.getRouting();
+  const auto eventIdIt = eventIds.find(eventName);
+  return eventIdIt != eventIds.end() &&
+      routes.find(getRouteKey(emitterReactTag, eventIdIt->second)) !=
+      routes.end();
+}
+
+void EventHandlerRegistry::flushCoalescedEvents(jsi::Runtime &rt) {
+  // handlers may receive new events meanwhile, they wait for the next flush
+  auto events = std::move(coalescedEvents);
+  coalescedEvents.clear();
+  for (const auto &event : events) {
+    runCoalescedEvent(rt, event);
+  }
+}
+
+bool EventHandlerRegistry::flushEmitterCoalescedEvents(
+    jsi::Runtime &rt,
+    int emitterReactTag) {
+  const auto emitterEventsIt = std::stable_partition(
+      coalescedEvents.begin(),
+      coalescedEvents.end(),
+      [&](const CoalescedEvent &event) {
+        return event.emitterReactTag != emitterReactTag;
+      });
+  if (emitterEventsIt == coalescedEvents.end()) {
+    return false;
+  }
+  std::vector<CoalescedEvent> events(
+      std::make_move_iterator(emitterEventsIt),
+      std::make_move_iterator(coalescedEvents.end()));
+  coalescedEvents.erase(emitterEventsIt, coalescedEvents.end());
+  bool ranWorklets = false;
+  for (const auto &event : events) {
+    ranWorklets |= runCoalescedEvent(rt, event);
+  }
+  return ranWorklets;
+}
+
+bool EventHandlerRegistry::runCoalescedEvent(
+    jsi::Runtime &rt,
+    const CoalescedEvent &event) {
+  const auto handlerIt = eventHandlers.find(event.handler->getHandlerId());
+  if (handlerIt == eventHandlers.end() || handlerIt->second != event.handler) {
+    // unregistered since the event arrived
+    return false;
+  }
+  event.payload.asObject(rt).setProperty(
+      rt, "droppedEventsCount", static_cast<double>(event.droppedEventsCount));
+  event.handler->process(event.eventTimestamp, event.payload);
+  return true;
 }
 
 } // namespace reanimated
@@ -1,10 +1,9 @@
 #pragma once
 
 #include <jsi/jsi.h>
-#include <map>
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <mutex>
-#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -16,32 +15,132 @@ namespace reanimated {
 
 class WorkletEventHandler;
 
+struct EventHandlingResult {
+  // every handler of the event consumes it, so it doesn't have to be
+  // dispatched to React, false if no handler is registered for the event
+  bool consumed = false;
+  // a worklet ran, so it might have enqueued updates; coalescing handlers only
+  // queue the event until the next frame
+  bool ranWorklets = false;
+};
+
+// Events are dispatched from the published routing, so that events nobody
+// listens to cost a hash lookup. Handlers are (un)registered on the UI thread
+// only, by copying the current routing and publishing the copy. Replaced
+// routings are freed on the UI thread too, once per frame, see
+// `collectRetiredRoutings`. So events, which are processed on the UI thread,
+// get the routing with a single load. Lookups from other threads are counted
+// by `OffThreadReadGuard`, and the replaced routings are kept while one runs.
 class EventHandlerRegistry {
-  std::map<
-      std::pair<int, std::string>,
-      std::unordered_map<uint64_t, std::shared_ptr<WorkletEventHandler>>>
-      eventMappingsWithTag;
-  std::map<
-      std::string,
-      std::unordered_map<uint64_t, std::shared_ptr<WorkletEventHandler>>>
-      eventMappingsWithoutTag;
-  std::map<uint64_t, std::shared_ptr<WorkletEventHandler>> eventHandlers;
-  std::mutex instanceMutex;
+  using EventId = uint32_t;
+  // Shared between the routings, only the changed ones are copied.
+  using Handlers = std::vector<std::shared_ptr<WorkletEventHandler>>;
+
+  struct Routing {
+    // Event names are interned when a handler is registered, so that events
+    // which nobody listens to are rejected with a single lookup.
+    std::unordered_map<std::string, EventId> eventIds;
+    // by emitter tag and event id, see `getRouteKey`
+    std::unordered_map<uint64_t, std::shared_ptr<const Handlers>> routes;
+  };
+
+  // Counts the lookups from other threads between loading `publishedRouting`
+  // and being done with it.
+  class OffThreadReadGuard {
+   public:
+    explicit OffThreadReadGuard(const EventHandlerRegistry &registry);
+    ~OffThreadReadGuard();
+
+    const Routing &getRouting() const {
+      return *routing_;
+    }
+
+   private:
+    const EventHandlerRegistry &registry_;
+    const Routing *routing_;
+  };
+
+  std::atomic<const Routing *> publishedRouting{nullptr};
+  mutable std::atomic<uint32_t> offThreadReaders{0};
+
+  // The latest event of an emitter for a coalescing handler, waiting for
+  // `flushCoalescedEvents`.
+  struct CoalescedEvent {
+    std::shared_ptr<WorkletEventHandler> handler;
+    int emitterReactTag;
+    double eventTimestamp;
+    jsi::Value payload;
+    // older events of the emitter which the handler won't see
+    uint32_t droppedEventsCount;
+  };
+
+  // UI thread only
+  std::vector<CoalescedEvent> coalescedEvents;
+  std::unique_ptr<const Routing> currentRouting = std::make_unique<Routing>();
+  std::vector<std::unique_ptr<const Routing>> retiredRoutings;
+  std::unordered_map<uint64_t, std::shared_ptr<WorkletEventHandler>>
+      eventHandlers;
+
+  // used as the tag of handlers which ignore the emitter
+  static constexpr int kAnyEmitterReactTag = -1;
+
+  static uint64_t getRouteKey(int emitterReactTag, EventId eventId) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(emitterReactTag))
+            << 32) |
+        eventId;
+  }
+
+  static int getRouteTag(const WorkletEventHandler &eventHandler);
+
+  // UI thread only, the routing can't be freed while it's used
+  const Routing &loadRouting() const {
+    return *publishedRouting.load(std::memory_order_acquire);
+  }
+
+  void publish(std::unique_ptr<const Routing> newRouting);
+
+  // Runs the coalesced events of the emitter right away, so that a discrete
+  // event of the emitter doesn't overtake them.
+  bool flushEmitterCoalescedEvents(jsi::Runtime &rt, int emitterReactTag);
+  bool runCoalescedEvent(jsi::Runtime &rt, const CoalescedEvent &event);
 
  public:
+  EventHandlerRegistry() {
+    publishedRouting = currentRouting.get();
+  }
+
   void registerEventHandler(std::shared_ptr<WorkletEventHandler> eventHandler);
   void unregisterEventHandler(uint64_t id);
 
-  void processEvent(
+  EventHandlingResult processEvent(
       jsi::Runtime &rt,
       double eventTimestamp,
       const std::string &eventName,
       const int emitterReactTag,
       const jsi::Value &eventPayload);
 
+  // Any thread.
   bool isAnyHandlerWaitingForEvent(
       const std::string &eventName,
       const int emitterReactTag);
+
+  // Runs the coalescing handlers with the latest events since the last call,
+  // with the number of events they missed as `droppedEventsCount`. Meant to
+  // be called once per frame, UI thread only.
+  void flushCoalescedEvents(jsi::Runtime &rt);
+
+  bool hasCoalescedEvents() const {
+    return !coalescedEvents.empty();
+  }
+
+  // Frees the replaced routings, unless a lookup from another thread is
+  // running, which may still use one of them. Meant to be called once per
+  // frame while `hasRetiredRoutings`, UI thread only.
+  void collectRetiredRoutings();
+
+  bool hasRetiredRoutings() const {
+    return !retiredRoutings.empty();
+  }
 };
 
 } // namespace reanimated
@@ -0,0 +1,143 @@
+#include "FrameCallbackRegistry.h"
+
+#include <utility>
+
+namespace reanimated {
+
+void FrameCallbackRegistry::requestFrame(FrameRequest request) {
+  frameRequests_.push_back(std::move(request));
+}
+
+void FrameCallbackRegistry::registerCallback(
+    FrameCallbackId id,
+    Callback callback) {
+  callbacks_[id].callback = std::move(callback);
+}
+
+void FrameCallbackRegistry::unregisterCallback(FrameCallbackId id) {
+  auto it = callbacks_.find(id);
+  if (it == callbacks_.end()) {
+    return;
+  }
+  auto &entry = it->second;
+  entry.removed = true;
+  entry.active = false;
+  if (isRunningFrame_) {
+    // the callback may be the one that's running right now
+    deferredChanges_.push_back(id);
+    return;
+  }
+  updateActiveList(entry);
+  callbacks_.erase(it);
+}
+
+void FrameCallbackRegistry::setActive(FrameCallbackId id, bool active) {
+  auto it = callbacks_.find(id);
+  if (it == callbacks_.end() || it->second.removed ||
+      it->second.active == active) {
+    return;
+  }
+  auto &entry = it->second;
+  entry.active = active;
+  if (!active) {
+    entry.startTime.reset();
+  }
+  if (isRunningFrame_) {
+    deferredChanges_.push_back(id);
+    return;
+  }
+  updateActiveList(entry);
+}
+
+size_t FrameCallbackRegistry::runFrame(double timestampMs) {
+  size_t callbacksRun = 0;
+  {
+    // Applies the changes made by the callbacks also when one of them throws.
+    struct FrameScope {
+      FrameCallbackRegistry &registry;
+      ~FrameScope() {
+        registry.runningFrameRequests_.clear();
+        registry.isRunningFrame_ = false;
+        registry.applyDeferredChanges();
+      }
+    } frameScope{*this};
+    isRunningFrame_ = true;
+
+    // Requests made from now on go to the other buffer and run next frame.
+    std::swap(frameRequests_, runningFrameRequests_);
+    for (auto &request : runningFrameRequests_) {
+      request(timestampMs);
+    }
+    callbacksRun += runningFrameRequests_.size();
+
+    const double timeSincePreviousFrame = previousFrameTimestamp_.has_value()
+        ? timestampMs - *previousFrameTimestamp_
+        : 0;
+    // Callbacks activated during this frame are appended after the frame, so
+    // the size can't change while we iterate.
+    for (auto *entry : activeCallbacks_) {
+      if (!entry->active) {
+        // deactivated earlier in this frame
+        continue;
+      }
+      if (!entry->startTime.has_value()) {
+        entry->startTime = timestampMs;
+        entry->callback(FrameInfo{timestampMs, std::nullopt, 0});
+      } else {
+        entry->callback(FrameInfo{
+            timestampMs,
+            timeSincePreviousFrame,
+            timestampMs - *entry->startTime});
+      }
+      ++callbacksRun;
+    }
+  }
+
+  if (activeCallbacks_.empty()) {
+    previousFrameTimestamp_.reset();
+  } else {
+    previousFrameTimestamp_ = timestampMs;
+  }
+  return callbacksRun;
+}
+
+void FrameCallbackRegistry::clear() {
+  frameRequests_.clear();
+  runningFrameRequests_.clear();
+  activeCallbacks_.clear();
+  deferredChanges_.clear();
+  callbacks_.clear();
+  previousFrameTimestamp_.reset();
+}
+
+void FrameCallbackRegistry::updateActiveList(Entry &entry) {
+  const bool shouldBeActive = entry.active && !entry.removed;
+  if (shouldBeActive && entry.activeIndex == kInactive) {
+    entry.activeIndex = activeCallbacks_.size();
+    activeCallbacks_.push_back(&entry);
+  } else if (!shouldBeActive && entry.activeIndex != kInactive) {
+    // swap with the last element to remove in O(1)
+    auto *last = activeCallbacks_.back();
+    activeCallbacks_[entry.activeIndex] = last;
+    last->activeIndex = entry.activeIndex;
+    activeCallbacks_.pop_back();
+    entry.activeIndex = kInactive;
+  }
+}
+
+void FrameCallbackRegistry::applyDeferredChanges() {
+  for (auto id : deferredChanges_) {
+    auto it = callbacks_.find(id);
+    if (it == callbacks_.end()) {
+      // removed by an earlier entry of the list
+      continue;
+    }
+    updateActiveList(it->second);
+    if (it->second.removed) {
+      callbacks_.erase(it);
+    }
+  }
+  deferredChanges_.clear();
+}
+
+} // namespace reanimated
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "UniqueFunction.h"
+
+namespace reanimated {
+
+using FrameCallbackId = uint64_t;
+
+struct FrameInfo {
+  double timestamp;
+  // empty on the first frame after the callback became active
+  std::optional<double> timeSincePreviousFrame;
+  double timeSinceFirstFrame;
+};
+
+// Holds the callbacks run by the UI thread on every frame. There are two kinds
+// of callbacks:
+// - one-shot frame requests (`requestAnimationFrame`), kept in two buffers
+//   that are swapped every frame, so requests made while a frame is running
+//   land in the other buffer and nothing is copied,
+// - persistent callbacks (`useFrameCallback`) with stable ids, which run on
+//   every frame while they are active.
+//
+// Everything except `reserveId` has to be called on the UI thread. Callbacks
+// may register, unregister and (de)activate other callbacks, including
+// themselves, while a frame is running. Such changes take effect after the
+// frame.
+class FrameCallbackRegistry {
+ public:
+  using FrameRequest = UniqueFunction<void(double timestampMs)>;
+  using Callback = UniqueFunction<void(const FrameInfo &frameInfo)>;
+
+  // Any thread. Returns an id for a callback registered later with
+  // `registerCallback`, which lets callers hand out ids synchronously.
+  FrameCallbackId reserveId() {
+    return nextId_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void requestFrame(FrameRequest request);
+
+  // The callback starts inactive.
+  void registerCallback(FrameCallbackId id, Callback callback);
+  void unregisterCallback(FrameCallbackId id);
+  void setActive(FrameCallbackId id, bool active);
+
+  // Returns true if `runFrame` should be called on the next frame.
+  inline bool hasPendingCallbacks() const {
+    return !frameRequests_.empty() || !activeCallbacks_.empty();
+  }
+
+  // Returns the number of frame requests and callbacks run.
+  size_t runFrame(double timestampMs);
+
+  // Drops all callbacks, has to be called before the runtime referenced by
+  // them is destroyed.
+  void clear();
+
+ private:
+  static constexpr size_t kInactive = SIZE_MAX;
+
+  struct Entry {
+    Callback callback;
+    bool active = false;
+    bool removed = false;
+    size_t activeIndex = kInactive; // position in `activeCallbacks_`
+    std::optional<double> startTime;
+  };
+
+  void updateActiveList(Entry &entry);
+  void applyDeferredChanges();
+
+  std::atomic<FrameCallbackId> nextId_{1};
+  std::vector<FrameRequest> frameRequests_;
+  std::vector<FrameRequest> runningFrameRequests_;
+  // map nodes are stable, which lets `activeCallbacks_` point to them
+  std::unordered_map<FrameCallbackId, Entry> callbacks_;
+  std::vector<Entry *> activeCallbacks_;
+  // ids of callbacks changed while a frame was running
+  std::vector<FrameCallbackId> deferredChanges_;
+  std::optional<double> previousFrameTimestamp_;
+  bool isRunningFrame_ = false;
+};
+
+} // namespace reanimated
@@ -0,0 +1,296 @@
+#include "MapperRegistry.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+
+namespace reanimated {
+
+namespace {
+
+void sortUnique(std::vector<SharedValueId> &ids) {
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+} // namespace
+
+void MapperRegistry::startMapper(
+    MapperId id,
+    jsi::Function worklet,
+    std::vector<SharedValueId> inputs,
+    std::vector<SharedValueId> outputs) {
+  stopMapper(id);
+  sortUnique(inputs);
+  sortUnique(outputs);
+  auto mapper = std::make_unique<Mapper>(Mapper{
+      id, std::move(worklet), std::move(inputs), std::move(outputs)});
+  auto &newMapper = *mapper;
+  mappers_.emplace(id, std::move(mapper));
+  addTo(readers_, newMapper.inputs, &newMapper);
+  addTo(writers_, newMapper.outputs, &newMapper);
+
+  newMapper.dirty = false;
+  if (!tryInsertRank(newMapper)) {
+    newMapper.rank = nextRank_;
+    sort();
+  }
+  markDirty(newMapper);
+}
+
+void MapperRegistry::stopMapper(MapperId id) {
+  auto it = mappers_.find(id);
+  if (it == mappers_.end()) {
+    return;
+  }
+  auto mapper = std::move(it->second);
+  mappers_.erase(it);
+  // the order of the remaining mappers stays valid, entries in `dirtyHeap_`
+  // are skipped
+  removeFrom(readers_, mapper->inputs, mapper.get());
+  removeFrom(writers_, mapper->outputs, mapper.get());
+  if (isRunning_) {
+    stoppedDuringRun_.push_back(std::move(mapper));
+  }
+}
+
+void MapperRegistry::markInputDirty(SharedValueId sharedValueId) {
+  auto it = readers_.find(sharedValueId);
+  if (it == readers_.end()) {
+    return;
+  }
+  for (auto *mapper : it->second) {
+    markDirty(*mapper);
+  }
+}
+
+size_t MapperRegistry::run(jsi::Runtime &rt) {
+  runRequested_ = false;
+  if (isRunning_) {
+    return 0;
+  }
+  // Cleans up also when a mapper throws, the mappers left dirty run on the
+  // next request.
+  struct RunScope {
+    MapperRegistry &registry;
+    ~RunScope() {
+      registry.isRunning_ = false;
+      registry.stoppedDuringRun_.clear();
+      for (auto id : registry.deferred_) {
+        auto it = registry.mappers_.find(id);
+        if (it != registry.mappers_.end() && it->second->dirty) {
+          registry.pushDirty(*it->second);
+        }
+      }
+      registry.deferred_.clear();
+    }
+  };
+
+  size_t mappersRun = 0;
+  {
+    RunScope runScope{*this};
+    isRunning_ = true;
+    while (!dirtyHeap_.empty()) {
+      std::pop_heap(
+          dirtyHeap_.begin(), dirtyHeap_.end(), std::greater<>());
+      const auto [rank, id] = dirtyHeap_.back();
+      dirtyHeap_.pop_back();
+      auto it = mappers_.find(id);
+      if (it == mappers_.end() || !it->second->dirty ||
+          it->second->rank != rank) {
+        continue;
+      }
+      // the mapper may be stopped while it runs, `stoppedDuringRun_` keeps it
+      // alive until the run ends
+      auto &mapper = *it->second;
+      mapper.dirty = false;
+      runningRank_ = rank;
+      ++mappersRun;
+      mapper.worklet.call(rt);
+    }
+  }
+  if (!dirtyHeap_.empty()) {
+    // In general, mappers shouldn't update their own inputs or the inputs of
+    // the mappers that already ran, as those would see the old value. It's
+    // still possible, so to not fall into an infinite loop such mappers run on
+    // the next frame, same as in JS.
+    requestRun(true);
+  }
+  return mappersRun;
+}
+
+void MapperRegistry::clear() {
+  mappers_.clear();
+  readers_.clear();
+  writers_.clear();
+  dirtyHeap_.clear();
+  deferred_.clear();
+  stoppedDuringRun_.clear();
+  nextRank_ = kRankGap;
+  runningRank_ = 0;
+  // a run requested before is for the dropped mappers
+  runRequested_ = false;
+}
+
+void MapperRegistry::addTo(
+    std::unordered_map<SharedValueId, MapperList> &index,
+    const std::vector<SharedValueId> &sharedValueIds,
+    Mapper *mapper) {
+  for (auto sharedValueId : sharedValueIds) {
+    index[sharedValueId].push_back(mapper);
+  }
+}
+
+void MapperRegistry::removeFrom(
+    std::unordered_map<SharedValueId, MapperList> &index,
+    const std::vector<SharedValueId> &sharedValueIds,
+    Mapper *mapper) {
+  for (auto sharedValueId : sharedValueIds) {
+    auto it = index.find(sharedValueId);
+    if (it == index.end()) {
+      continue;
+    }
+    auto &mappers = it->second;
+    mappers.erase(std::find(mappers.begin(), mappers.end(), mapper));
+    if (mappers.empty()) {
+      index.erase(it);
+    }
+  }
+}
+
+bool MapperRegistry::tryInsertRank(Mapper &mapper) {
+  // the mapper has to run after the ones which write its inputs...
+  Rank lowerBound = 0;
+  for (auto input : mapper.inputs) {
+    auto it = writers_.find(input);
+    if (it == writers_.end()) {
+      continue;
+    }
+    for (const auto *writer : it->second) {
+      if (writer != &mapper) {
+        lowerBound = std::max(lowerBound, writer->rank);
+      }
+    }
+  }
+  // ...and before the ones which read its outputs
+  Rank upperBound = std::numeric_limits<Rank>::max();
+  for (auto output : mapper.outputs) {
+    auto it = readers_.find(output);
+    if (it == readers_.end()) {
+      continue;
+    }
+    for (const auto *reader : it->second) {
+      if (reader != &mapper) {
+        upperBound = std::min(upperBound, reader->rank);
+      }
+    }
+  }
+
+  if (upperBound == std::numeric_limits<Rank>::max()) {
+    // the common case, nothing reads the outputs yet
+    mapper.rank = nextRank_;
+    nextRank_ += kRankGap;
+    return true;
+  }
+  if (upperBound > lowerBound + 1) {
+    mapper.rank = lowerBound + (upperBound - lowerBound) / 2;
+    return true;
+  }
+  return false;
+}
+
+void MapperRegistry::sort() {
+  // DFS on the transposed graph, same as the JS registry did: a mapper gets
+  // its rank after all the mappers writing its inputs got theirs. Cycles are
+  // broken at the first visited mapper. Mappers are visited in their current
+  // order so that unrelated mappers keep it.
+  std::vector<Mapper *> mappers;
+  mappers.reserve(mappers_.size());
+  for (auto &[id, mapper] : mappers_) {
+    mappers.push_back(mapper.get());
+  }
+  std::sort(mappers.begin(), mappers.end(), [](Mapper *a, Mapper *b) {
+    return a->rank < b->rank;
+  });
+
+  struct Frame {
+    Mapper *mapper;
+    size_t inputIndex;
+    size_t writerIndex;
+  };
+  std::vector<Frame> stack;
+  std::unordered_set<const Mapper *> visited;
+  visited.reserve(mappers.size());
+  Rank rank = 0;
+  for (auto *root : mappers) {
+    if (!visited.insert(root).second) {
+      continue;
+    }
+    stack.push_back({root, 0, 0});
+    while (!stack.empty()) {
+      auto &frame = stack.back();
+      Mapper *next = nullptr;
+      while (next == nullptr &&
+             frame.inputIndex < frame.mapper->inputs.size()) {
+        auto it = writers_.find(frame.mapper->inputs[frame.inputIndex]);
+        if (it == writers_.end() || frame.writerIndex >= it->second.size()) {
+          ++frame.inputIndex;
+          frame.writerIndex = 0;
+          continue;
+        }
+        auto *writer = it->second[frame.writerIndex++];
+        if (visited.insert(writer).second) {
+          next = writer;
+        }
+      }
+      if (next != nullptr) {
+        stack.push_back({next, 0, 0});
+        continue;
+      }
+      rank += kRankGap;
+      frame.mapper->rank = rank;
+      stack.pop_back();
+    }
+  }
+  nextRank_ = rank + kRankGap;
+
+  dirtyHeap_.clear();
+  deferred_.clear();
+  for (auto *mapper : mappers) {
+    if (mapper->dirty) {
+      pushDirty(*mapper);
+    }
+  }
+}
+
+void MapperRegistry::markDirty(Mapper &mapper) {
+  if (mapper.dirty) {
+    return;
+  }
+  mapper.dirty = true;
+  if (isRunning_) {
+    if (mapper.rank <= runningRank_) {
+      deferred_.push_back(mapper.id);
+    } else {
+      pushDirty(mapper);
+    }
+    return;
+  }
+  pushDirty(mapper);
+  requestRun(false);
+}
+
+void MapperRegistry::pushDirty(Mapper &mapper) {
+  dirtyHeap_.emplace_back(mapper.rank, mapper.id);
+  std::push_heap(dirtyHeap_.begin(), dirtyHeap_.end(), std::greater<>());
+}
+
+void MapperRegistry::requestRun(bool nextFrame) {
+  if (runRequested_ || !requestRun_) {
+    return;
+  }
+  runRequested_ = true;
+  requestRun_(nextFrame);
+}
+
+} // namespace reanimated
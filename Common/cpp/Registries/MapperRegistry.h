@@ -0,0 +1,111 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace facebook;
+
+namespace reanimated {
+
+using MapperId = uint64_t;
+using SharedValueId = uint64_t;
+
+// Dependency graph of the mappers (`useAnimatedStyle`, `useDerivedValue`,
+// `useAnimatedReaction`) run on the UI runtime. Shared values are identified
+// by ids handed out by the JS side of the registry (mappers.ts).
+//
+// A mapper becomes dirty when one of its inputs is written and only dirty
+// mappers run, in topological order, so the cost of a run is proportional to
+// the number of mappers whose inputs changed. The order is kept in sparse
+// ranks: a new mapper is usually placed between its producers and consumers
+// without touching the others and the graph is only re-sorted when there's no
+// room left.
+//
+// Everything has to be called on the UI thread.
+class MapperRegistry {
+ public:
+  // Called when the mappers have to be run, with `nextFrame` set for the ones
+  // made dirty by a mapper that already ran in the current run.
+  using RequestRunFunction = std::function<void(bool nextFrame)>;
+
+  void setRequestRunFunction(RequestRunFunction requestRun) {
+    requestRun_ = std::move(requestRun);
+  }
+
+  // The mapper starts dirty.
+  void startMapper(
+      MapperId id,
+      jsi::Function worklet,
+      std::vector<SharedValueId> inputs,
+      std::vector<SharedValueId> outputs);
+  void stopMapper(MapperId id);
+
+  // Marks the mappers which read the shared value as dirty.
+  void markInputDirty(SharedValueId sharedValueId);
+
+  // Runs the dirty mappers, may throw if one of them does. Returns the number
+  // of mappers run.
+  size_t run(jsi::Runtime &rt);
+
+  // Drops all mappers, has to be called before the runtime goes away.
+  void clear();
+
+ private:
+  using Rank = uint64_t;
+  static constexpr Rank kRankGap = 1 << 10;
+
+  struct Mapper {
+    MapperId id;
+    jsi::Function worklet;
+    std::vector<SharedValueId> inputs;
+    std::vector<SharedValueId> outputs;
+    Rank rank = 0;
+    bool dirty = true;
+  };
+
+  using MapperList = std::vector<Mapper *>;
+
+  static void addTo(
+      std::unordered_map<SharedValueId, MapperList> &index,
+      const std::vector<SharedValueId> &sharedValueIds,
+      Mapper *mapper);
+  static void removeFrom(
+      std::unordered_map<SharedValueId, MapperList> &index,
+      const std::vector<SharedValueId> &sharedValueIds,
+      Mapper *mapper);
+
+  bool tryInsertRank(Mapper &mapper);
+  void sort();
+  void markDirty(Mapper &mapper);
+  void pushDirty(Mapper &mapper);
+  void requestRun(bool nextFrame);
+
+  std::unordered_map<MapperId, std::unique_ptr<Mapper>> mappers_;
+  // shared value -> mappers which read it
+  std::unordered_map<SharedValueId, MapperList> readers_;
+  // shared value -> mappers which write it
+  std::unordered_map<SharedValueId, MapperList> writers_;
+  Rank nextRank_ = kRankGap;
+
+  // Min-heap of (rank, mapper) of the dirty mappers. Entries of stopped or
+  // re-ranked mappers are skipped when popped.
+  std::vector<std::pair<Rank, MapperId>> dirtyHeap_;
+  // Mappers made dirty while running which rank at or before the running one,
+  // like in JS they run in the next run.
+  std::vector<MapperId> deferred_;
+  // Mappers stopped while running, one of them may be the running one.
+  std::vector<std::unique_ptr<Mapper>> stoppedDuringRun_;
+  Rank runningRank_ = 0;
+  bool isRunning_ = false;
+  bool runRequested_ = false;
+  RequestRunFunction requestRun_;
+};
+
+} // namespace reanimated
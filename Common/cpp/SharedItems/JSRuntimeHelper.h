@@ -2,8 +2,12 @@
 
 #include <jsi/jsi.h>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "JSScheduler.h"
 #include "UIScheduler.h"
@@ -21,15 +25,22 @@ class CoreFunction {
  private:
   std::unique_ptr<jsi::Function> rnFunction_;
   std::unique_ptr<jsi::Function> uiFunction_;
+  // copies compiled for background worklet runtimes
+  std::unordered_map<jsi::Runtime *, std::unique_ptr<jsi::Function>>
+      backgroundFunctions_;
+  std::mutex backgroundFunctionsMutex_; // Protects `backgroundFunctions_`.
   std::string functionBody_;
   std::string location_;
   JSRuntimeHelper
       *runtimeHelper_; // runtime helper holds core function references, so we
   // use normal pointer here to avoid ref cycles.
   std::unique_ptr<jsi::Function> &getFunction(jsi::Runtime &rt);
+  std::unique_ptr<jsi::Function> evaluate(jsi::Runtime &rt);
 
  public:
   CoreFunction(JSRuntimeHelper *runtimeHelper, const jsi::Value &workletObject);
+  // Has to be called on the runtime's thread before the runtime is destroyed.
+  void releaseRuntime(jsi::Runtime &rt);
   template <typename... Args>
   jsi::Value call(jsi::Runtime &rt, Args &&...args) {
     return getFunction(rt)->call(rt, args...);
@@ -55,6 +66,9 @@ class JSRuntimeHelper {
         jsScheduler_(jsScheduler) {}
 
   volatile bool uiRuntimeDestroyed = false;
+  // Set before the first background worklet runtime starts, from then on
+  // shareables keep what these runtimes need to unpack them.
+  std::atomic<bool> backgroundRuntimesStarted{false};
   std::unique_ptr<CoreFunction> callGuard;
   std::unique_ptr<CoreFunction> valueUnpacker;
 
@@ -74,12 +88,23 @@ class JSRuntimeHelper {
     return &rt == rnRuntime_;
   }
 
-  void scheduleOnUI(std::function<void()> job) {
-    uiScheduler_->scheduleOnUI(job);
+  // Drops the core functions compiled for a background worklet runtime that's
+  // about to be destroyed.
+  void releaseRuntime(jsi::Runtime &rt) {
+    if (callGuard) {
+      callGuard->releaseRuntime(rt);
+    }
+    if (valueUnpacker) {
+      valueUnpacker->releaseRuntime(rt);
+    }
   }
 
-  void scheduleOnJS(std::function<void()> job) {
-    jsScheduler_->scheduleOnJS(job);
+  void scheduleOnUI(UniqueFunction<void()> job) {
+    uiScheduler_->scheduleOnUI(std::move(job));
+  }
+
+  void scheduleOnJS(UniqueFunction<void()> job) {
+    jsScheduler_->scheduleOnJS(std::move(job));
   }
 
   template <typename... Args>
@@ -25,6 +25,11 @@ class RuntimeManager {
     RuntimeDecorator::registerRuntime(this->runtime.get(), runtimeType);
   }
 
+  ~RuntimeManager() {
+    // frees the runtime's slot in the registry, e.g. on reload
+    RuntimeDecorator::unregisterRuntime(runtime.get());
+  }
+
   /**
    Holds the jsi::Runtime this RuntimeManager is managing.
    */
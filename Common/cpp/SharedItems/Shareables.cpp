@@ -20,25 +20,48 @@ CoreFunction::CoreFunction(
           workletObject.getProperty(rt, "__workletHash").getNumber()));
 }
 
+std::unique_ptr<jsi::Function> CoreFunction::evaluate(jsi::Runtime &rt) {
+  // the newline before closing paren is needed because the last line can be
+  // an inline comment (specifically this happens when we attach source maps
+  // at the end) in which case the paren won't be parsed
+  auto codeBuffer =
+      std::make_shared<const jsi::StringBuffer>("(" + functionBody_ + "\n)");
+  return std::make_unique<jsi::Function>(
+      rt.evaluateJavaScript(codeBuffer, location_).asObject(rt).asFunction(rt));
+}
+
 std::unique_ptr<jsi::Function> &CoreFunction::getFunction(jsi::Runtime &rt) {
   if (runtimeHelper_->isUIRuntime(rt)) {
     if (uiFunction_ == nullptr) {
       // maybe need to initialize UI Function
-      // the newline before closing paren is needed because the last line can be
-      // an inline comment (specifically this happens when we attach source maps
-      // at the end) in which case the paren won't be parsed
-      auto codeBuffer = std::make_shared<const jsi::StringBuffer>(
-          "(" + functionBody_ + "\n)");
-      uiFunction_ = std::make_unique<jsi::Function>(
-          rt.evaluateJavaScript(codeBuffer, location_)
-              .asObject(rt)
-              .asFunction(rt));
+      uiFunction_ = evaluate(rt);
     }
     return uiFunction_;
-  } else {
+  } else if (runtimeHelper_->isRNRuntime(rt)) {
     // running on the main RN runtime
     return rnFunction_;
   }
+  // Running on a background worklet runtime. Map nodes are stable, so the
+  // returned reference stays valid after the lock is released.
+  std::lock_guard<std::mutex> lock(backgroundFunctionsMutex_);
+  auto &function = backgroundFunctions_[&rt];
+  if (function == nullptr) {
+    function = evaluate(rt);
+  }
+  return function;
+}
+
+void CoreFunction::releaseRuntime(jsi::Runtime &rt) {
+  std::unique_ptr<jsi::Function> function; // destroyed outside of the lock
+  {
+    std::lock_guard<std::mutex> lock(backgroundFunctionsMutex_);
+    auto it = backgroundFunctions_.find(&rt);
+    if (it == backgroundFunctions_.end()) {
+      return;
+    }
+    function = std::move(it->second);
+    backgroundFunctions_.erase(it);
+  }
 }
 
 std::shared_ptr<Shareable> extractShareableOrThrow(
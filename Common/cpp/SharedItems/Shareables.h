@@ -2,6 +2,8 @@
 
 #include <jsi/jsi.h>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -76,6 +78,10 @@ class RetainingShareable : virtual public BaseClass {
       // only case where it can be realistically called this way is when a
       // shared value is created and then accessed on the same runtime
       return BaseClass::toJSValue(rt);
+    } else if (!runtimeHelper_->isUIRuntime(rt)) {
+      // The retained value belongs to the UI runtime, background worklet
+      // runtimes always get a fresh copy.
+      return BaseClass::toJSValue(rt);
     } else if (remoteValue_ == nullptr) {
       auto value = BaseClass::toJSValue(rt);
       remoteValue_ = std::make_unique<jsi::Value>(rt, value);
@@ -249,7 +255,7 @@ class ShareableRemoteFunction
         function_(std::move(function)),
         runtimeHelper_(runtimeHelper) {}
   jsi::Value toJSValue(jsi::Runtime &rt) override {
-    if (runtimeHelper_->isUIRuntime(rt)) {
+    if (!runtimeHelper_->isRNRuntime(rt)) {
 #ifdef DEBUG
       return runtimeHelper_->valueUnpacker->call(
           rt,
@@ -267,9 +273,25 @@ class ShareableRemoteFunction
 class ShareableHandle : public Shareable {
  private:
   std::shared_ptr<JSRuntimeHelper> runtimeHelper_;
+  // Guards the release of `initializer_`, which background runtimes read from
+  // their own threads.
+  std::mutex initializerMutex_;
   std::unique_ptr<ShareableObject> initializer_;
   std::unique_ptr<jsi::Value> remoteValue_;
 
+  jsi::Value toBackgroundJSValue(jsi::Runtime &rt) {
+    std::unique_lock<std::mutex> lock(initializerMutex_);
+    if (initializer_ == nullptr) {
+      throw std::runtime_error(
+          "[Reanimated] A shared value used on the UI runtime before "
+          "background runtimes were started can't be used on them, call "
+          "`startBackgroundRuntimes` earlier.");
+    }
+    auto initObj = initializer_->getJSValue(rt);
+    lock.unlock();
+    return runtimeHelper_->valueUnpacker->call(rt, initObj);
+  }
+
  public:
   ShareableHandle(
       const std::shared_ptr<JSRuntimeHelper> runtimeHelper,
@@ -302,12 +324,20 @@ class ShareableHandle : public Shareable {
     }
   }
   jsi::Value toJSValue(jsi::Runtime &rt) override {
-    if (initializer_ != nullptr) {
+    if (!runtimeHelper_->isUIRuntime(rt) && !runtimeHelper_->isRNRuntime(rt)) {
+      // Background worklet runtimes unpack their own instance every time.
+      return toBackgroundJSValue(rt);
+    }
+    if (remoteValue_ == nullptr) {
       auto initObj = initializer_->getJSValue(rt);
       remoteValue_ = std::make_unique<jsi::Value>(
           runtimeHelper_->valueUnpacker->call(rt, initObj));
-      initializer_ = nullptr; // we can release ref to initializer as this
-      // method should be called at most once
+      // we can release ref to initializer as this method should be called at
+      // most once, unless background runtimes unpack it too
+      if (!runtimeHelper_->backgroundRuntimesStarted) {
+        std::lock_guard<std::mutex> lock(initializerMutex_);
+        initializer_ = nullptr;
+      }
     }
     return jsi::Value(rt, *remoteValue_);
   }
@@ -342,6 +372,9 @@ class ShareableSynchronizedDataHolder
       } else {
         return jsi::Value(rt, *uiValue_);
       }
+    } else if (!runtimeHelper_->isRNRuntime(rt)) {
+      // background worklet runtimes don't cache the value
+      return data_->getJSValue(rt);
     } else {
       if (rnValue_ == nullptr) {
         auto value = data_->getJSValue(rt);
@@ -0,0 +1,15 @@
+#include "EventPayload.h"
+
+#include <jsi/JSIDynamic.h>
+
+namespace reanimated {
+
+jsi::Value eventPayloadFromDynamic(
+    jsi::Runtime &rt,
+    const folly::dynamic &payload) {
+  // JSIDynamic converts doubles as they are, only folly::toJson rejects
+  // non-finite numbers
+  return jsi::valueFromDynamic(rt, payload);
+}
+
+} // namespace reanimated
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <folly/dynamic.h>
+#include <jsi/jsi.h>
+
+using namespace facebook;
+
+namespace reanimated {
+
+// Converts the contents of a native event, e.g. of a ReadableNativeMap on
+// Android, straight to a JS value. Unlike a round trip through JSON, this
+// keeps NaN and Infinity as numbers instead of failing on them. A null payload
+// becomes `null`.
+jsi::Value eventPayloadFromDynamic(
+    jsi::Runtime &rt,
+    const folly::dynamic &payload);
+
+} // namespace reanimated
@@ -0,0 +1,189 @@
+#include "FrameTimingRecorder.h"
+
+#include <bitset>
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+
+namespace reanimated {
+
+#if REANIMATED_FRAME_TIMING
+
+namespace {
+
+const char *phaseName(FramePhase phase) {
+  switch (phase) {
+    case FramePhase::Frame:
+      return "Frame";
+    case FramePhase::UIJobs:
+      return "UI jobs";
+    case FramePhase::DeferrableUIJobs:
+      return "Deferrable UI jobs";
+    case FramePhase::NativeAnimations:
+      return "Native animations";
+    case FramePhase::Mappers:
+      return "Mappers";
+    case FramePhase::Event:
+      return "Event";
+    case FramePhase::PerformOperations:
+      return "performOperations";
+    case FramePhase::SynchronousPropsUpdate:
+      return "Synchronous props update";
+    case FramePhase::Commit:
+      return "Commit";
+    case FramePhase::CloneWithNewProps:
+      return "Clone with new props";
+  }
+  return "Unknown";
+}
+
+const char *countName(FramePhase phase) {
+  switch (phase) {
+    case FramePhase::Frame:
+      return "callbacks";
+    case FramePhase::UIJobs:
+    case FramePhase::DeferrableUIJobs:
+      return "jobs";
+    case FramePhase::NativeAnimations:
+      return "animations";
+    case FramePhase::Mappers:
+      return "mappers";
+    case FramePhase::PerformOperations:
+      return "updates";
+    case FramePhase::SynchronousPropsUpdate:
+    case FramePhase::Commit:
+    case FramePhase::CloneWithNewProps:
+      return "views";
+    default:
+      return "count";
+  }
+}
+
+} // namespace
+
+uint8_t FrameTimingRecorder::currentThreadIndex() {
+  // shared by all recorders, so that a thread has the same index in each trace
+  static std::atomic<uint32_t> nextThreadIndex{1};
+  thread_local const uint32_t threadIndex =
+      nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+  return static_cast<uint8_t>(threadIndex < kMaxThreads ? threadIndex : 0);
+}
+
+void FrameTimingRecorder::setCurrentThreadName(const char *name) {
+  threadNames_[currentThreadIndex()].store(name, std::memory_order_relaxed);
+}
+
+void FrameTimingRecorder::record(
+    FramePhase phase,
+    int64_t startNs,
+    int64_t endNs,
+    uint32_t count) {
+  const auto index = writeIndex_.fetch_add(1, std::memory_order_relaxed);
+  auto &slot = slots_[index & (kCapacity - 1)];
+  // seqlock write, readers which see the zero or a changed sequence drop the
+  // span
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.phaseThreadAndCount.store(
+      static_cast<uint64_t>(phase) |
+          (static_cast<uint64_t>(currentThreadIndex()) << 8) |
+          (static_cast<uint64_t>(count) << 16),
+      std::memory_order_relaxed);
+  slot.startNs.store(startNs, std::memory_order_relaxed);
+  slot.durationNs.store(endNs - startNs, std::memory_order_relaxed);
+  slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+bool FrameTimingRecorder::readSlot(uint64_t index, Span &span) const {
+  const auto &slot = slots_[index & (kCapacity - 1)];
+  if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+    // not written yet or already reused for a newer span
+    return false;
+  }
+  const auto phaseThreadAndCount =
+      slot.phaseThreadAndCount.load(std::memory_order_relaxed);
+  span.phase = static_cast<FramePhase>(phaseThreadAndCount & 0xff);
+  span.threadIndex = static_cast<uint8_t>((phaseThreadAndCount >> 8) & 0xff);
+  span.count = static_cast<uint32_t>(phaseThreadAndCount >> 16);
+  span.startNs = slot.startNs.load(std::memory_order_relaxed);
+  span.durationNs = slot.durationNs.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.sequence.load(std::memory_order_relaxed) == index + 1;
+}
+
+std::string FrameTimingRecorder::toTraceJSON() const {
+  const auto end = writeIndex_.load(std::memory_order_acquire);
+  const auto begin = end > kCapacity ? end - kCapacity : 0;
+
+  std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  char buffer[256];
+  Span span;
+  std::bitset<kMaxThreads> threadsWithSpans;
+  for (auto index = begin; index < end; ++index) {
+    if (!readSlot(index, span)) {
+      continue;
+    }
+    threadsWithSpans.set(span.threadIndex);
+    // timestamps are in microseconds
+    std::snprintf(
+        buffer,
+        sizeof(buffer),
+        "{\"name\":\"%s\",\"cat\":\"reanimated\",\"ph\":\"X\",\"pid\":1,"
+        "\"tid\":%u,\"ts\":%" PRId64 ".%03" PRId64 ",\"dur\":%" PRId64
+        ".%03" PRId64 ",\"args\":{\"%s\":%" PRIu32 "}},",
+        phaseName(span.phase),
+        static_cast<unsigned>(span.threadIndex),
+        span.startNs / 1000,
+        span.startNs % 1000,
+        span.durationNs / 1000,
+        span.durationNs % 1000,
+        countName(span.phase),
+        span.count);
+    json += buffer;
+  }
+  // one track per thread
+  for (size_t threadIndex = 0; threadIndex < kMaxThreads; ++threadIndex) {
+    if (!threadsWithSpans.test(threadIndex)) {
+      continue;
+    }
+    const char *name =
+        threadNames_[threadIndex].load(std::memory_order_relaxed);
+    if (name == nullptr) {
+      std::snprintf(
+          buffer,
+          sizeof(buffer),
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,"
+          "\"args\":{\"name\":\"Thread %zu\"}},",
+          threadIndex,
+          threadIndex);
+    } else {
+      std::snprintf(
+          buffer,
+          sizeof(buffer),
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,"
+          "\"args\":{\"name\":\"%s\"}},",
+          threadIndex,
+          name);
+    }
+    json += buffer;
+  }
+  if (json.back() == ',') {
+    json.pop_back();
+  }
+  json += "]}";
+  return json;
+}
+
+#else
+
+void FrameTimingRecorder::record(FramePhase, int64_t, int64_t, uint32_t) {}
+
+void FrameTimingRecorder::setCurrentThreadName(const char *) {}
+
+std::string FrameTimingRecorder::toTraceJSON() const {
+  return "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}";
+}
+
+#endif // REANIMATED_FRAME_TIMING
+
+} // namespace reanimated
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Define as 0 to compile the instrumentation out. Scopes become empty objects
+// and the trace is always empty.
+#ifndef REANIMATED_FRAME_TIMING
+#define REANIMATED_FRAME_TIMING 1
+#endif
+
+namespace reanimated {
+
+enum class FramePhase : uint8_t {
+  // `onRender`, the count is the number of frame callbacks and requests run.
+  Frame,
+  // Draining the frame-critical UI jobs, the count is the number of jobs.
+  UIJobs,
+  // Running the deferrable UI jobs that fit in the frame budget.
+  DeferrableUIJobs,
+  // Stepping the animations run by the native animation driver, the count is
+  // the number of animations.
+  NativeAnimations,
+  // Running the dirty mappers, the count is the number of mappers run.
+  Mappers,
+  // Running the event handlers of one event.
+  Event,
+  // `performOperations`, the count is the number of props updates.
+  PerformOperations,
+  // Applying non-layout props directly, the count is the number of views.
+  SynchronousPropsUpdate,
+  // Shadow tree commit including cloning, the count is the number of views.
+  Commit,
+  // Cloning the shadow tree with the new props, inside of `Commit`.
+  CloneWithNewProps,
+};
+
+// Records the time the UI thread spends in each phase of a frame into a fixed
+// size ring buffer which keeps the most recent spans. Writing a span takes a
+// couple of relaxed atomic stores, so it's cheap enough to stay enabled.
+// Recording may happen on any thread, reading never blocks the writers and
+// skips the spans that were overwritten while it was copying them. Every span
+// remembers the thread it was recorded on, so that each thread gets its own
+// track in the trace.
+class FrameTimingRecorder {
+ public:
+  static constexpr size_t kCapacity = 4096; // must be a power of two
+  // Threads beyond that share the track with index 0.
+  static constexpr size_t kMaxThreads = 64;
+
+  struct Span {
+    FramePhase phase;
+    // small process-wide index of the thread, not the OS thread id
+    uint8_t threadIndex;
+    uint32_t count;
+    int64_t startNs;
+    int64_t durationNs;
+  };
+
+  static inline int64_t toNs(std::chrono::steady_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               time.time_since_epoch())
+        .count();
+  }
+
+  static inline int64_t now() {
+    return toNs(std::chrono::steady_clock::now());
+  }
+
+  void record(FramePhase phase, int64_t startNs, int64_t endNs, uint32_t count);
+
+  // Names the track of the calling thread in the trace, `name` has to outlive
+  // the recorder (e.g. a string literal). Tracks of unnamed threads are named
+  // after their index.
+  void setCurrentThreadName(const char *name);
+
+  // Returns the recorded spans in the Chrome trace event format, it can be
+  // loaded into chrome://tracing or Perfetto.
+  std::string toTraceJSON() const;
+
+ private:
+#if REANIMATED_FRAME_TIMING
+  struct Slot {
+    // Index of the span plus one, zero while the slot is being written.
+    std::atomic<uint64_t> sequence{0};
+    // phase in the lowest byte, thread index in the next one, count above
+    std::atomic<uint64_t> phaseThreadAndCount{0};
+    std::atomic<int64_t> startNs{0};
+    std::atomic<int64_t> durationNs{0};
+  };
+
+  static uint8_t currentThreadIndex();
+
+  bool readSlot(uint64_t index, Span &span) const;
+
+  std::atomic<uint64_t> writeIndex_{0};
+  std::array<Slot, kCapacity> slots_;
+  std::array<std::atomic<const char *>, kMaxThreads> threadNames_{};
+#endif
+};
+
+// Records the time between its construction and destruction as a span of the
+// given phase. Does nothing when `recorder` is null.
+class FrameTimingScope {
+ public:
+#if REANIMATED_FRAME_TIMING
+  FrameTimingScope(FrameTimingRecorder *recorder, FramePhase phase)
+      : recorder_(recorder),
+        phase_(phase),
+        startNs_(recorder ? FrameTimingRecorder::now() : 0) {}
+
+  ~FrameTimingScope() {
+    if (recorder_) {
+      recorder_->record(phase_, startNs_, FrameTimingRecorder::now(), count_);
+    }
+  }
+
+  inline void setCount(size_t count) {
+    count_ = static_cast<uint32_t>(count);
+  }
+#else
+  FrameTimingScope(FrameTimingRecorder *, FramePhase) {}
+
+  inline void setCount(size_t) {}
+#endif
+
+  FrameTimingScope(const FrameTimingScope &) = delete;
+  FrameTimingScope &operator=(const FrameTimingScope &) = delete;
+
+ private:
+#if REANIMATED_FRAME_TIMING
+  FrameTimingRecorder *recorder_;
+  FramePhase phase_;
+  uint32_t count_ = 0;
+  int64_t startNs_;
+#endif
+};
+
+} // namespace reanimated
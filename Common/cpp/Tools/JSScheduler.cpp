@@ -4,8 +4,78 @@
 
 namespace reanimated {
 
-void JSScheduler::scheduleOnJS(std::function<void()> job) {
-  jsCallInvoker_->invokeAsync(std::move(job));
+JSScheduler::BatchScope::BatchScope(JSScheduler *jsScheduler)
+    : jsScheduler_(jsScheduler) {
+  if (jsScheduler_ != nullptr) {
+    ++jsScheduler_->batchDepth_;
+  }
+}
+
+JSScheduler::BatchScope::~BatchScope() {
+  if (jsScheduler_ != nullptr && --jsScheduler_->batchDepth_ == 0) {
+    jsScheduler_->flushBatch();
+  }
+}
+
+void JSScheduler::scheduleOnJS(UniqueFunction<void()> job) {
+  // CallInvoker only accepts copyable `std::function`s, so instead of wrapping
+  // every job we keep them in our own queue and only dispatch a drain when the
+  // queue was empty. Jobs scheduled before the JS thread gets to it ride along.
+  if (jsJobs_.push(std::move(job))) {
+    scheduleTriggerOnJS();
+  }
+}
+
+void JSScheduler::scheduleBatchedOnJS(
+    UniqueFunction<void()> job,
+    const void *latestWinsKey) {
+  if (batchDepth_ == 0) {
+    scheduleOnJS(std::move(job));
+    return;
+  }
+  if (latestWinsKey != nullptr) {
+    auto [it, inserted] =
+        latestWinsIndices_.try_emplace(latestWinsKey, batch_.size());
+    if (!inserted) {
+      batch_[it->second] = nullptr;
+      it->second = batch_.size();
+    }
+  }
+  batch_.push_back(std::move(job));
+}
+
+void JSScheduler::flushBatch() {
+  if (batch_.empty()) {
+    return;
+  }
+  latestWinsIndices_.clear();
+  scheduleOnJS([batch = std::move(batch_)]() mutable {
+    for (auto &job : batch) {
+      if (job) {
+        job();
+      }
+    }
+  });
+  batch_ = std::vector<UniqueFunction<void()>>();
+}
+
+void JSScheduler::scheduleTriggerOnJS() {
+  jsCallInvoker_->invokeAsync([weakThis = weak_from_this()] {
+    if (auto strongThis = weakThis.lock()) {
+      strongThis->triggerJS();
+    }
+  });
+}
+
+void JSScheduler::triggerJS() {
+  try {
+    jsJobs_.drain([](UniqueFunction<void()> &&job) { job(); });
+  } catch (...) {
+    // Remaining jobs are kept in the queue, make sure they still run after the
+    // error is reported.
+    scheduleTriggerOnJS();
+    throw;
+  }
 }
 
 } // namespace reanimated
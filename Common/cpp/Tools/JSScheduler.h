@@ -3,18 +3,52 @@
 #include <ReactCommon/CallInvoker.h>
 
 #include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "MPSCQueue.h"
+#include "UniqueFunction.h"
 
 namespace reanimated {
 
-class JSScheduler {
+class JSScheduler : public std::enable_shared_from_this<JSScheduler> {
  public:
+  // While at least one BatchScope is alive, jobs passed to
+  // `scheduleBatchedOnJS` are collected and sent to the JS thread as a single
+  // job when the outermost scope ends. Scopes are opened by the UI thread
+  // around each tick (`triggerUI`, `onRender`, event handling).
+  class BatchScope {
+   public:
+    explicit BatchScope(JSScheduler *jsScheduler);
+    ~BatchScope();
+
+   private:
+    JSScheduler *jsScheduler_;
+  };
+
   explicit JSScheduler(
       const std::shared_ptr<facebook::react::CallInvoker> &jsCallInvoker)
       : jsCallInvoker_(jsCallInvoker) {}
-  void scheduleOnJS(std::function<void()> job);
+  void scheduleOnJS(UniqueFunction<void()> job);
+  // UI thread only. Jobs scheduled with the same non-null `latestWinsKey`
+  // within one batch replace each other, only the last one is run (in the
+  // position of the last call).
+  void scheduleBatchedOnJS(
+      UniqueFunction<void()> job,
+      const void *latestWinsKey = nullptr);
 
  protected:
+  void scheduleTriggerOnJS();
+  void triggerJS();
+  void flushBatch();
+
   const std::shared_ptr<facebook::react::CallInvoker> jsCallInvoker_;
+  MPSCQueue<UniqueFunction<void()>> jsJobs_;
+
+  // UI thread only.
+  int batchDepth_ = 0;
+  std::vector<UniqueFunction<void()>> batch_;
+  std::unordered_map<const void *, size_t> latestWinsIndices_;
 };
 
 } // namespace reanimated
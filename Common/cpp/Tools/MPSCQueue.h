@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace reanimated {
+
+// Lock-free multi-producer single-consumer queue. Producers push onto an
+// intrusive stack with a single CAS, the consumer detaches the whole stack
+// with one atomic exchange and reverses it to restore FIFO order. There is no
+// ABA hazard because the consumer never pops single nodes from the shared
+// stack.
+//
+// `drain` must only ever be called from one thread at a time (in practice the
+// UI thread), `push` may be called concurrently from any thread.
+template <typename T>
+class MPSCQueue {
+ public:
+  MPSCQueue() = default;
+  MPSCQueue(const MPSCQueue &) = delete;
+  MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+  ~MPSCQueue() {
+    drain([](T &&) {});
+  }
+
+  // Returns true if the queue was empty before the push, which lets callers
+  // schedule exactly one drain per batch of jobs.
+  bool push(T &&item) {
+    auto node = new Node{std::move(item), nullptr};
+    auto head = head_.load(std::memory_order_relaxed);
+    do {
+      node->next = head;
+    } while (!head_.compare_exchange_weak(
+        head, node, std::memory_order_release, std::memory_order_relaxed));
+    return head == nullptr;
+  }
+
+  bool push(const T &item) {
+    T copy = item;
+    return push(std::move(copy));
+  }
+
+  // Takes all items pushed so far with a single atomic operation and passes
+  // them to `consumer` in FIFO order. Items pushed while draining are left for
+  // the next call. If `consumer` throws, the items that were not consumed yet
+  // are kept (in order) and delivered first by the next `drain`.
+  template <typename Consumer>
+  size_t drain(Consumer &&consumer) {
+    Node *fifo = pending_;
+    pending_ = nullptr;
+    Node *tail = fifo;
+    while (tail != nullptr && tail->next != nullptr) {
+      tail = tail->next;
+    }
+
+    Node *detached =
+        reverse(head_.exchange(nullptr, std::memory_order_acquire));
+    if (tail == nullptr) {
+      fifo = detached;
+    } else {
+      tail->next = detached;
+    }
+
+    PendingGuard guard{pending_, fifo};
+    size_t count = 0;
+    while (guard.node != nullptr) {
+      Node *node = guard.node;
+      guard.node = node->next;
+      T item = std::move(node->item);
+      delete node;
+      consumer(std::move(item));
+      ++count;
+    }
+    return count;
+  }
+
+ private:
+  struct Node {
+    T item;
+    Node *next;
+  };
+
+  // Puts unconsumed nodes back to `pending_` if the consumer throws.
+  struct PendingGuard {
+    Node *&pending;
+    Node *node;
+    ~PendingGuard() {
+      pending = node;
+    }
+  };
+
+  static Node *reverse(Node *node) {
+    Node *reversed = nullptr;
+    while (node != nullptr) {
+      Node *next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+    return reversed;
+  }
+
+  std::atomic<Node *> head_{nullptr};
+  Node *pending_ = nullptr; // only accessed by the consumer
+};
+
+} // namespace reanimated
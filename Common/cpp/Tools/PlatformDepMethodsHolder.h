@@ -3,6 +3,7 @@
 #include <jsi/jsi.h>
 
 #ifdef RCT_NEW_ARCH_ENABLED
+#include <folly/dynamic.h>
 #include <react/renderer/core/ReactPrimitives.h>
 #endif
 
@@ -21,7 +22,7 @@ namespace reanimated {
 #ifdef RCT_NEW_ARCH_ENABLED
 
 using SynchronouslyUpdateUIPropsFunction =
-    std::function<void(jsi::Runtime &rt, Tag tag, const jsi::Object &props)>;
+    std::function<void(jsi::Runtime &rt, Tag tag, const folly::dynamic &props)>;
 using UpdatePropsFunction =
     std::function<void(jsi::Runtime &rt, const jsi::Value &operations)>;
 using RemoveFromPropsRegistryFunction =
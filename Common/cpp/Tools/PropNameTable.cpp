@@ -0,0 +1,94 @@
+#include "PropNameTable.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace reanimated {
+
+void PropNameTable::configure(const std::string &name, PropKind kind) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &kinds = kinds_[internLocked(name)];
+  if ((kinds & kind) == 0) {
+    kinds |= kind;
+    ++version_;
+  }
+}
+
+PropNameId PropNameTable::intern(const std::string &name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return internLocked(name);
+}
+
+uint8_t PropNameTable::getKinds(PropNameId id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return kinds_.at(id);
+}
+
+PropNameId PropNameTable::internLocked(const std::string &name) {
+  auto it = ids_.find(name);
+  if (it != ids_.end()) {
+    return it->second;
+  }
+  if (kinds_.size() > std::numeric_limits<PropNameId>::max()) {
+    throw std::runtime_error("[Reanimated] Too many distinct prop names.");
+  }
+  const auto id = static_cast<PropNameId>(kinds_.size());
+  auto &chunk = nameChunks_[id / kNameChunkSize];
+  if (chunk.load(std::memory_order_relaxed) == nullptr) {
+    ownedNameChunks_.push_back(std::make_unique<NameChunk>());
+    chunk.store(ownedNameChunks_.back().get(), std::memory_order_release);
+  }
+  // Readers get `id` from this call or a later lookup under the lock, so the
+  // name is visible to them.
+  (*chunk.load(std::memory_order_relaxed))[id % kNameChunkSize] = name;
+  ids_.emplace(name, id);
+  kinds_.push_back(kUnknownProp);
+  return id;
+}
+
+const PropsShape &PropsShapeCache::getShape(
+    jsi::Runtime &rt,
+    PropNameTable &table,
+    int viewTag,
+    const jsi::Object &props) {
+  const jsi::Array propNames = props.getPropertyNames(rt);
+  const size_t size = propNames.size(rt);
+  std::vector<jsi::String> names;
+  names.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    names.push_back(propNames.getValueAtIndex(rt, i).asString(rt));
+  }
+
+  const auto version = table.getVersion();
+  auto &entry = entries_[viewTag];
+  if (entry.version == version && entry.shape.names.size() == size &&
+      std::equal(
+          names.begin(),
+          names.end(),
+          entry.shape.names.begin(),
+          [&rt](const jsi::String &a, const jsi::String &b) {
+            return jsi::String::strictEquals(rt, a, b);
+          })) {
+    return entry.shape;
+  }
+
+  entry.shape.keys.clear();
+  entry.shape.ids.clear();
+  entry.shape.propKinds.clear();
+  entry.shape.kinds = kUnknownProp;
+  for (const auto &name : names) {
+    auto key = name.utf8(rt);
+    const auto id = table.intern(key);
+    const auto kinds = table.getKinds(id);
+    entry.shape.keys.push_back(std::move(key));
+    entry.shape.ids.push_back(id);
+    entry.shape.propKinds.push_back(kinds);
+    entry.shape.kinds |= kinds;
+  }
+  entry.shape.names = std::move(names);
+  entry.version = version;
+  return entry.shape;
+}
+
+} // namespace reanimated
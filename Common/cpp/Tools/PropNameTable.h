@@ -0,0 +1,125 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace facebook;
+
+namespace reanimated {
+
+using PropNameId = uint16_t;
+
+// What Reanimated knows about a prop, set by `configureProps`. A prop can be
+// neither, e.g. a prop of a third party component.
+enum PropKind : uint8_t {
+  kUnknownProp = 0,
+  // can be applied directly to the view (opacity, transform, ...)
+  kUIProp = 1 << 0,
+  // needs to go through the UIManager, on Fabric these are the layout props
+  // which require a commit
+  kNativeProp = 1 << 1,
+};
+
+// Interns prop names into small integer ids. The table only grows, so ids stay
+// valid for the lifetime of the module.
+//
+// Thread-safe, `configure` is called on the JS thread and the lookups happen on
+// the UI thread. Names never move once interned, so `getName` doesn't take the
+// lock, e.g. when React's commit thread reads PropsRegistry.
+class PropNameTable {
+ public:
+  void configure(const std::string &name, PropKind kind);
+
+  PropNameId intern(const std::string &name);
+
+  uint8_t getKinds(PropNameId id) const;
+
+  // `id` has to be returned by `intern` or `configure` (on any thread) before.
+  const std::string &getName(PropNameId id) const {
+    return (*nameChunks_[id / kNameChunkSize].load(
+        std::memory_order_acquire))[id % kNameChunkSize];
+  }
+
+  // Bumped whenever a kind is added, results computed from older versions
+  // have to be recomputed.
+  uint32_t getVersion() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return version_;
+  }
+
+ private:
+  static constexpr size_t kNameChunkSize = 256;
+  static constexpr size_t kMaxNameChunks =
+      (std::numeric_limits<PropNameId>::max() + size_t{1}) / kNameChunkSize;
+  using NameChunk = std::array<std::string, kNameChunkSize>;
+
+  PropNameId internLocked(const std::string &name);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, PropNameId> ids_;
+  // Names by id, allocated a chunk at a time and published to the readers.
+  // Written under the lock, a name is never changed once written.
+  std::array<std::atomic<NameChunk *>, kMaxNameChunks> nameChunks_{};
+  std::vector<std::unique_ptr<NameChunk>> ownedNameChunks_;
+  std::vector<uint8_t> kinds_;
+  uint32_t version_ = 0;
+};
+
+// The keys of a props update, as returned by the runtime, as C++ strings and as
+// ids, together with their kinds.
+struct PropsShape {
+  std::vector<jsi::String> names;
+  // converted once per shape, used as the keys of the converted props
+  std::vector<std::string> keys;
+  std::vector<PropNameId> ids;
+  // kinds of each of the props
+  std::vector<uint8_t> propKinds;
+  // all of `propKinds` combined
+  uint8_t kinds = kUnknownProp;
+};
+
+// Remembers the shape of the last props update of every view. Animated styles
+// update the same keys on every frame, for them `getShape` only compares the
+// key strings returned by the runtime, which are interned by the runtime as
+// well, and never converts them to C++ strings.
+//
+// UI thread only.
+class PropsShapeCache {
+ public:
+  const PropsShape &getShape(
+      jsi::Runtime &rt,
+      PropNameTable &table,
+      int viewTag,
+      const jsi::Object &props);
+
+  void remove(int viewTag) {
+    entries_.erase(viewTag);
+  }
+
+  // Has to be called before the runtime goes away.
+  void clear() {
+    entries_.clear();
+  }
+
+ private:
+  static constexpr uint32_t kNoVersion = std::numeric_limits<uint32_t>::max();
+
+  struct Entry {
+    PropsShape shape;
+    uint32_t version = kNoVersion;
+  };
+
+  std::unordered_map<int, Entry> entries_;
+};
+
+} // namespace reanimated
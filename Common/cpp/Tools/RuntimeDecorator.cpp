@@ -2,6 +2,8 @@
 #include <jsi/instrumentation.h>
 #include <chrono>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <unordered_map>
 #include <utility>
 #include "JSISerializer.h"
@@ -18,16 +20,36 @@ static void logValue(jsi::Runtime &rt, jsi::Value const &value) {
   Logger::log(stringifyJSIValue(rt, value));
 }
 
-std::unordered_map<RuntimePointer, RuntimeType>
-    &RuntimeDecorator::runtimeRegistry() {
-  static std::unordered_map<RuntimePointer, RuntimeType> runtimeRegistry;
-  return runtimeRegistry;
+std::mutex &RuntimeDecorator::runtimeRegistryMutex() {
+  static std::mutex runtimeRegistryMutex;
+  return runtimeRegistryMutex;
 }
 
 void RuntimeDecorator::registerRuntime(
     jsi::Runtime *runtime,
     RuntimeType runtimeType) {
-  runtimeRegistry().insert({runtime, runtimeType});
+  std::lock_guard<std::mutex> lock(runtimeRegistryMutex());
+  if (findRuntime(*runtime) != nullptr) {
+    return;
+  }
+  for (auto &registeredRuntime : registeredRuntimes_) {
+    if (registeredRuntime.runtime.load(std::memory_order_relaxed) == nullptr) {
+      registeredRuntime.type.store(runtimeType, std::memory_order_relaxed);
+      registeredRuntime.runtime.store(runtime, std::memory_order_release);
+      return;
+    }
+  }
+  throw std::runtime_error("[Reanimated] Too many worklet runtimes.");
+}
+
+void RuntimeDecorator::unregisterRuntime(jsi::Runtime *runtime) {
+  std::lock_guard<std::mutex> lock(runtimeRegistryMutex());
+  for (auto &registeredRuntime : registeredRuntimes_) {
+    if (registeredRuntime.runtime.load(std::memory_order_relaxed) == runtime) {
+      registeredRuntime.runtime.store(nullptr, std::memory_order_relaxed);
+      return;
+    }
+  }
 }
 
 void RuntimeDecorator::decorateRuntime(
@@ -85,6 +107,11 @@ void RuntimeDecorator::decorateUIRuntime(
 #endif
     const DispatchCommandFunction dispatchCommand,
     const RequestFrameFunction requestFrame,
+    const StartNativeAnimationFunction startNativeAnimation,
+    const StopNativeAnimationFunction stopNativeAnimation,
+    const StartMapperFunction startMapper,
+    const StopMapperFunction stopMapper,
+    const MarkMapperInputDirtyFunction markMapperInputDirty,
     const ScheduleOnJSFunction scheduleOnJS,
     const MakeShareableCloneFunction makeShareableClone,
     const UpdateDataSynchronouslyFunction updateDataSynchronously,
@@ -121,6 +148,14 @@ void RuntimeDecorator::decorateUIRuntime(
 #endif // RCT_NEW_ARCH_ENABLED
 
   jsi_utils::installJsiFunction(rt, "requestAnimationFrame", requestFrame);
+  jsi_utils::installJsiFunction(
+      rt, "_startNativeAnimation", startNativeAnimation);
+  jsi_utils::installJsiFunction(
+      rt, "_stopNativeAnimation", stopNativeAnimation);
+  jsi_utils::installJsiFunction(rt, "_startMapper", startMapper);
+  jsi_utils::installJsiFunction(rt, "_stopMapper", stopMapper);
+  jsi_utils::installJsiFunction(
+      rt, "_markMapperInputDirty", markMapperInputDirty);
   jsi_utils::installJsiFunction(rt, "_scheduleOnJS", scheduleOnJS);
   jsi_utils::installJsiFunction(rt, "_makeShareableClone", makeShareableClone);
   jsi_utils::installJsiFunction(
@@ -152,6 +187,17 @@ void RuntimeDecorator::decorateUIRuntime(
       rt, "_maybeFlushUIUpdatesQueue", maybeFlushUIUpdatesQueueFunction);
 }
 
+void RuntimeDecorator::decorateBackgroundRuntime(
+    jsi::Runtime &rt,
+    const std::string &label,
+    const ScheduleOnJSFunction scheduleOnJS,
+    const MakeShareableCloneFunction makeShareableClone) {
+  RuntimeDecorator::decorateRuntime(rt, label);
+
+  jsi_utils::installJsiFunction(rt, "_scheduleOnJS", scheduleOnJS);
+  jsi_utils::installJsiFunction(rt, "_makeShareableClone", makeShareableClone);
+}
+
 void RuntimeDecorator::decorateRNRuntime(
     jsi::Runtime &rnRuntime,
     const std::shared_ptr<jsi::Runtime> &uiRuntime,
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include "PlatformDepMethodsHolder.h"
@@ -13,10 +16,30 @@ namespace reanimated {
 
 using RequestFrameFunction =
     std::function<void(jsi::Runtime &, const jsi::Value &)>;
-using ScheduleOnJSFunction =
-    std::function<void(jsi::Runtime &, const jsi::Value &, const jsi::Value &)>;
+using ScheduleOnJSFunction = std::function<void(
+    jsi::Runtime &,
+    const jsi::Value &,
+    const jsi::Value &,
+    const jsi::Value &)>;
 using MakeShareableCloneFunction =
     std::function<jsi::Value(jsi::Runtime &, const jsi::Value &)>;
+using StartNativeAnimationFunction = std::function<jsi::Value(
+    jsi::Runtime &,
+    const jsi::Value &,
+    const jsi::Value &,
+    const jsi::Value &)>;
+using StopNativeAnimationFunction =
+    std::function<void(jsi::Runtime &, const jsi::Value &)>;
+using StartMapperFunction = std::function<void(
+    jsi::Runtime &,
+    const jsi::Value &,
+    const jsi::Value &,
+    const jsi::Value &,
+    const jsi::Value &)>;
+using StopMapperFunction =
+    std::function<void(jsi::Runtime &, const jsi::Value &)>;
+using MarkMapperInputDirtyFunction =
+    std::function<void(jsi::Runtime &, const jsi::Value &)>;
 using UpdateDataSynchronouslyFunction =
     std::function<void(jsi::Runtime &, const jsi::Value &, const jsi::Value &)>;
 
@@ -49,6 +72,11 @@ class RuntimeDecorator {
 #endif
       const DispatchCommandFunction dispatchCommand,
       const RequestFrameFunction requestFrame,
+      const StartNativeAnimationFunction startNativeAnimation,
+      const StopNativeAnimationFunction stopNativeAnimation,
+      const StartMapperFunction startMapper,
+      const StopMapperFunction stopMapper,
+      const MarkMapperInputDirtyFunction markMapperInputDirty,
       const ScheduleOnJSFunction scheduleOnJS,
       const MakeShareableCloneFunction makeShareableClone,
       const UpdateDataSynchronouslyFunction updateDataSynchronously,
@@ -57,6 +85,11 @@ class RuntimeDecorator {
       const ProgressLayoutAnimationFunction progressLayoutAnimationFunction,
       const EndLayoutAnimationFunction endLayoutAnimationFunction,
       const MaybeFlushUIUpdatesQueueFunction maybeFlushUIUpdatesQueueFunction);
+  static void decorateBackgroundRuntime(
+      jsi::Runtime &rt,
+      const std::string &label,
+      const ScheduleOnJSFunction scheduleOnJS,
+      const MakeShareableCloneFunction makeShareableClone);
   static void decorateRNRuntime(
       jsi::Runtime &rnRuntime,
       const std::shared_ptr<jsi::Runtime> &uiRuntime,
@@ -80,31 +113,60 @@ class RuntimeDecorator {
    RuntimeManager, otherwise future runtime checks will fail.
    */
   static void registerRuntime(jsi::Runtime *runtime, RuntimeType runtimeType);
+  /**
+   Removes the given Runtime from the registry, has to be called before a
+   registered Runtime is destroyed.
+   */
+  static void unregisterRuntime(jsi::Runtime *runtime);
 
  private:
-  static std::unordered_map<RuntimePointer, RuntimeType> &runtimeRegistry();
+  // Runtime checks run on every thread, so they read the registered runtimes
+  // without locking. A slot's type is stored before its runtime is published,
+  // and a slot is only reused once its runtime is unregistered.
+  struct RegisteredRuntime {
+    std::atomic<RuntimePointer> runtime{nullptr};
+    std::atomic<RuntimeType> type{RuntimeType::Worklet};
+  };
+  static constexpr size_t kMaxRegisteredRuntimes = 32;
+
+  inline static const RegisteredRuntime *findRuntime(jsi::Runtime &rt);
+
+  static std::array<RegisteredRuntime, kMaxRegisteredRuntimes>
+      registeredRuntimes_;
+  // Background runtimes are registered from their own threads.
+  static std::mutex &runtimeRegistryMutex();
 };
 
+inline std::array<
+    RuntimeDecorator::RegisteredRuntime,
+    RuntimeDecorator::kMaxRegisteredRuntimes>
+    RuntimeDecorator::registeredRuntimes_;
+
+inline const RuntimeDecorator::RegisteredRuntime *
+RuntimeDecorator::findRuntime(jsi::Runtime &rt) {
+  for (const auto &registeredRuntime : registeredRuntimes_) {
+    if (registeredRuntime.runtime.load(std::memory_order_acquire) == &rt) {
+      return &registeredRuntime;
+    }
+  }
+  return nullptr;
+}
+
 inline bool RuntimeDecorator::isUIRuntime(jsi::Runtime &rt) {
-  auto iterator = runtimeRegistry().find(&rt);
-  if (iterator == runtimeRegistry().end())
+  const auto *registeredRuntime = findRuntime(rt);
+  if (registeredRuntime == nullptr)
     return false;
-  return iterator->second == RuntimeType::UI;
+  return registeredRuntime->type.load(std::memory_order_relaxed) ==
+      RuntimeType::UI;
 }
 
 inline bool RuntimeDecorator::isWorkletRuntime(jsi::Runtime &rt) {
-  auto iterator = runtimeRegistry().find(&rt);
-  if (iterator == runtimeRegistry().end())
-    return false;
-  auto type = iterator->second;
-  return type == RuntimeType::UI || type == RuntimeType::Worklet;
+  // every registered runtime is a UI or a worklet runtime
+  return findRuntime(rt) != nullptr;
 }
 
 inline bool RuntimeDecorator::isReactRuntime(jsi::Runtime &rt) {
-  auto iterator = runtimeRegistry().find(&rt);
-  if (iterator == runtimeRegistry().end())
-    return true;
-  return false;
+  return findRuntime(rt) == nullptr;
 }
 
 } // namespace reanimated
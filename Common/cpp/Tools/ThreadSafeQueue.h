@@ -20,7 +20,7 @@ class ThreadSafeQueue {
     while (queue_.empty()) {
       cond_.wait(mlock);
     }
-    auto item = queue_.front();
+    auto item = std::move(queue_.front());
     queue_.pop();
     return item;
   }
@@ -30,7 +30,7 @@ class ThreadSafeQueue {
     while (queue_.empty()) {
       cond_.wait(mlock);
     }
-    item = queue_.front();
+    item = std::move(queue_.front());
     queue_.pop();
   }
 
@@ -6,24 +6,110 @@
 
 namespace reanimated {
 
-void UIScheduler::scheduleOnUI(std::function<void()> job) {
-  uiJobs_.push(std::move(job));
+using Clock = std::chrono::steady_clock;
+
+void UIScheduler::scheduleOnUI(
+    UniqueFunction<void()> job,
+    UIJobPriority priority) {
+  if (priority == UIJobPriority::Deferrable) {
+    deferrableUIJobs_.push(std::move(job));
+  } else {
+    uiJobs_.push(std::move(job));
+  }
 }
 
 void UIScheduler::triggerUI() {
   scheduledOnUI_ = false;
+  const auto runtimeManager = weakRuntimeManager_.lock();
 #if JS_RUNTIME_HERMES
   // JSI's scope defined here allows for JSI-objects to be cleared up after
   // each runtime loop. Within these loops we typically create some temporary
   // JSI objects and hence it allows for such objects to be garbage collected
   // much sooner.
   // Apparently the scope API is only supported on Hermes at the moment.
-  const auto runtimeManager = weakRuntimeManager_.lock();
   const auto scope = jsi::Scope(*runtimeManager->runtime);
 #endif
-  while (uiJobs_.getSize()) {
-    const auto job = uiJobs_.pop();
+  // runOnJS calls made by the jobs below are sent to the JS thread at once.
+  JSScheduler::BatchScope jsBatch(
+      runtimeManager ? runtimeManager->jsScheduler_.get() : nullptr);
+  // Jobs scheduled while draining will be picked up by the next trigger as
+  // `scheduledOnUI_` has already been reset.
+  runFrameCriticalJobs();
+  runDeferrableJobs();
+}
+
+void UIScheduler::runFrameCriticalJobs() {
+  const auto start = Clock::now();
+  const auto jobsRun =
+      uiJobs_.drain([](UniqueFunction<void()> &&job) { job(); });
+  if (jobsRun == 0) {
+    return;
+  }
+  const auto end = Clock::now();
+  frameCriticalCounters_.jobsRun += jobsRun;
+  frameCriticalCounters_.timeSpentNs +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  if (frameTimingRecorder_) {
+    frameTimingRecorder_->record(
+        FramePhase::UIJobs,
+        FrameTimingRecorder::toNs(start),
+        FrameTimingRecorder::toNs(end),
+        jobsRun);
+  }
+}
+
+void UIScheduler::runDeferrableJobs() {
+  deferrableUIJobs_.drain([this](UniqueFunction<void()> &&job) {
+    postponedUIJobs_.push_back(std::move(job));
+  });
+  if (postponedUIJobs_.empty()) {
+    return;
+  }
+
+  const auto start = Clock::now();
+  if (start - frameStart_ >= frameInterval_) {
+    // triggerUI may be called several times per frame, the budget is shared
+    // between all of them
+    frameStart_ = start;
+    frameTimeSpent_ = std::chrono::nanoseconds(0);
+  }
+  // Without a way to request another frame we can't postpone anything.
+  const auto deadline = requestFrame_
+      ? start + (frameBudget_ - frameTimeSpent_)
+      : Clock::time_point::max();
+  // Always run at least one job per frame so that this lane makes progress
+  // even if a single job takes longer than the whole budget.
+  const bool mustRunOne = frameTimeSpent_.count() == 0;
+
+  auto now = start;
+  uint64_t jobsRun = 0;
+  while (!postponedUIJobs_.empty() &&
+         (now < deadline || (mustRunOne && jobsRun == 0))) {
+    auto job = std::move(postponedUIJobs_.front());
+    postponedUIJobs_.pop_front();
     job();
+    ++jobsRun;
+    now = Clock::now();
+  }
+
+  const auto timeSpent =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now - start);
+  frameTimeSpent_ += timeSpent;
+  deferrableCounters_.jobsRun += jobsRun;
+  deferrableCounters_.timeSpentNs += timeSpent.count();
+  if (frameTimingRecorder_) {
+    frameTimingRecorder_->record(
+        FramePhase::DeferrableUIJobs,
+        FrameTimingRecorder::toNs(start),
+        FrameTimingRecorder::toNs(now),
+        jobsRun);
+  }
+
+  if (!postponedUIJobs_.empty()) {
+    deferrableCounters_.jobsDeferred += postponedUIJobs_.size();
+    if (requestFrame_) {
+      requestFrame_();
+    }
   }
 }
 
@@ -32,6 +118,32 @@ void UIScheduler::setRuntimeManager(
   weakRuntimeManager_ = runtimeManager;
 }
 
+void UIScheduler::setRequestFrameFunction(std::function<void()> requestFrame) {
+  requestFrame_ = std::move(requestFrame);
+}
+
+void UIScheduler::setFrameBudget(
+    std::chrono::nanoseconds frameBudget,
+    std::chrono::nanoseconds frameInterval) {
+  frameBudget_ = frameBudget;
+  frameInterval_ = frameInterval;
+}
+
+void UIScheduler::setFrameTimingRecorder(
+    const std::shared_ptr<FrameTimingRecorder> &frameTimingRecorder) {
+  frameTimingRecorder_ = frameTimingRecorder;
+}
+
+UIJobLaneStats UIScheduler::getLaneStats(UIJobPriority priority) const {
+  const auto &counters = priority == UIJobPriority::Deferrable
+      ? deferrableCounters_
+      : frameCriticalCounters_;
+  return {
+      counters.jobsRun.load(),
+      counters.jobsDeferred.load(),
+      std::chrono::nanoseconds(counters.timeSpentNs.load())};
+}
+
 UIScheduler::~UIScheduler() {}
 
 } // namespace reanimated
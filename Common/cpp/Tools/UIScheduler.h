@@ -2,24 +2,80 @@
 
 #include <ReactCommon/CallInvoker.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <memory>
 
-#include "ThreadSafeQueue.h"
+#include "FrameTimingRecorder.h"
+#include "MPSCQueue.h"
+#include "UniqueFunction.h"
 
 namespace reanimated {
 
 class RuntimeManager;
 
+enum class UIJobPriority {
+  // Work that has to be done in the current frame, e.g. worklets scheduled
+  // with runOnUI or event handlers. Always drained completely.
+  FrameCritical,
+  // Work that can wait for one of the next frames, e.g. event handler
+  // registration. Gets at most `frameBudget` of UI thread time per frame.
+  Deferrable,
+};
+
+struct UIJobLaneStats {
+  uint64_t jobsRun;
+  uint64_t jobsDeferred;
+  std::chrono::nanoseconds timeSpent;
+};
+
 class UIScheduler {
  public:
   void setRuntimeManager(const std::shared_ptr<RuntimeManager> &runtimeManager);
-  virtual void scheduleOnUI(std::function<void()> job);
+  // Called from `triggerUI` when some deferrable jobs didn't fit in the budget.
+  // It should make sure `triggerUI` is called again on the next frame.
+  void setRequestFrameFunction(std::function<void()> requestFrame);
+  void setFrameBudget(
+      std::chrono::nanoseconds frameBudget,
+      std::chrono::nanoseconds frameInterval);
+  UIJobLaneStats getLaneStats(UIJobPriority priority) const;
+  // Has to be called before the first `triggerUI`.
+  void setFrameTimingRecorder(
+      const std::shared_ptr<FrameTimingRecorder> &frameTimingRecorder);
+  virtual void scheduleOnUI(
+      UniqueFunction<void()> job,
+      UIJobPriority priority = UIJobPriority::FrameCritical);
   virtual void triggerUI();
   virtual ~UIScheduler();
 
  protected:
+  struct LaneCounters {
+    std::atomic<uint64_t> jobsRun{0};
+    std::atomic<uint64_t> jobsDeferred{0};
+    std::atomic<int64_t> timeSpentNs{0};
+  };
+
+  void runFrameCriticalJobs();
+  void runDeferrableJobs();
+
   std::atomic<bool> scheduledOnUI_{false};
-  ThreadSafeQueue<std::function<void()>> uiJobs_;
+  MPSCQueue<UniqueFunction<void()>> uiJobs_;
+  MPSCQueue<UniqueFunction<void()>> deferrableUIJobs_;
+  // Deferrable jobs postponed by previous triggers, UI thread only.
+  std::deque<UniqueFunction<void()>> postponedUIJobs_;
+  // Half of a 120Hz frame by default, the rest is left for rendering.
+  std::chrono::nanoseconds frameBudget_{std::chrono::microseconds(4000)};
+  std::chrono::nanoseconds frameInterval_{std::chrono::microseconds(8333)};
+  // UI thread only.
+  std::chrono::steady_clock::time_point frameStart_;
+  std::chrono::nanoseconds frameTimeSpent_{0};
+  std::function<void()> requestFrame_;
+  LaneCounters frameCriticalCounters_;
+  LaneCounters deferrableCounters_;
+  std::shared_ptr<FrameTimingRecorder> frameTimingRecorder_;
   std::weak_ptr<RuntimeManager> weakRuntimeManager_;
 };
 
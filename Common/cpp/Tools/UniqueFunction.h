@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace reanimated {
+
+template <typename Signature>
+class UniqueFunction;
+
+// Move-only replacement for `std::function` used for jobs passed between
+// threads. Callables up to `kInlineSize` bytes are stored inline, which covers
+// the lambdas built by NativeReanimatedModule that capture a few shareables,
+// so scheduling a job doesn't allocate and never copies captured
+// `shared_ptr`s. Larger callables fall back to a heap allocation.
+template <typename R, typename... Args>
+class UniqueFunction<R(Args...)> {
+ public:
+  static constexpr size_t kInlineSize = 8 * sizeof(void *);
+
+  UniqueFunction() noexcept = default;
+
+  UniqueFunction(std::nullptr_t) noexcept {} // NOLINT(runtime/explicit)
+
+  template <
+      typename F,
+      typename Fn = std::decay_t<F>,
+      typename = std::enable_if_t<
+          !std::is_same_v<Fn, UniqueFunction> &&
+          std::is_invocable_r_v<R, Fn &, Args...>>>
+  UniqueFunction(F &&f) { // NOLINT(runtime/explicit)
+    if constexpr (isNullable<Fn>()) {
+      if (!f) {
+        return;
+      }
+    }
+    if constexpr (isInline<Fn>()) {
+      new (&storage_) Fn(std::forward<F>(f));
+    } else {
+      *reinterpret_cast<Fn **>(&storage_) = new Fn(std::forward<F>(f));
+    }
+    ops_ = &opsFor<Fn>;
+  }
+
+  UniqueFunction(UniqueFunction &&other) noexcept {
+    moveFrom(other);
+  }
+
+  UniqueFunction &operator=(UniqueFunction &&other) noexcept {
+    if (this != &other) {
+      reset();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  UniqueFunction &operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+  }
+
+  UniqueFunction(const UniqueFunction &) = delete;
+  UniqueFunction &operator=(const UniqueFunction &) = delete;
+
+  ~UniqueFunction() {
+    reset();
+  }
+
+  explicit operator bool() const noexcept {
+    return ops_ != nullptr;
+  }
+
+  R operator()(Args... args) {
+    if (ops_ == nullptr) {
+      throw std::bad_function_call();
+    }
+    return ops_->invoke(&storage_, std::forward<Args>(args)...);
+  }
+
+ private:
+  struct Ops {
+    R (*invoke)(void *storage, Args &&...args);
+    void (*relocate)(void *from, void *to) noexcept;
+    void (*destroy)(void *storage) noexcept;
+  };
+
+  template <typename Fn>
+  struct IsStdFunction : std::false_type {};
+
+  template <typename Signature>
+  struct IsStdFunction<std::function<Signature>> : std::true_type {};
+
+  template <typename Fn>
+  static constexpr bool isNullable() {
+    return std::is_pointer_v<Fn> || std::is_member_pointer_v<Fn> ||
+        IsStdFunction<Fn>::value;
+  }
+
+  template <typename Fn>
+  static constexpr bool isInline() {
+    return sizeof(Fn) <= kInlineSize &&
+        alignof(Fn) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<Fn>;
+  }
+
+  template <typename Fn>
+  static Fn &target(void *storage) {
+    if constexpr (isInline<Fn>()) {
+      return *std::launder(reinterpret_cast<Fn *>(storage));
+    } else {
+      return **reinterpret_cast<Fn **>(storage);
+    }
+  }
+
+  template <typename Fn>
+  static R invokeImpl(void *storage, Args &&...args) {
+    if constexpr (std::is_void_v<R>) {
+      std::invoke(target<Fn>(storage), std::forward<Args>(args)...);
+    } else {
+      return std::invoke(target<Fn>(storage), std::forward<Args>(args)...);
+    }
+  }
+
+  template <typename Fn>
+  static void relocateImpl(void *from, void *to) noexcept {
+    if constexpr (isInline<Fn>()) {
+      auto &source = target<Fn>(from);
+      new (to) Fn(std::move(source));
+      source.~Fn();
+    } else {
+      *reinterpret_cast<Fn **>(to) = *reinterpret_cast<Fn **>(from);
+    }
+  }
+
+  template <typename Fn>
+  static void destroyImpl(void *storage) noexcept {
+    if constexpr (isInline<Fn>()) {
+      target<Fn>(storage).~Fn();
+    } else {
+      delete *reinterpret_cast<Fn **>(storage);
+    }
+  }
+
+  template <typename Fn>
+  static constexpr Ops opsFor = {
+      &invokeImpl<Fn>,
+      &relocateImpl<Fn>,
+      &destroyImpl<Fn>};
+
+  void moveFrom(UniqueFunction &other) noexcept {
+    if (other.ops_ != nullptr) {
+      other.ops_->relocate(&other.storage_, &storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  void reset() noexcept {
+    if (ops_ != nullptr) {
+      ops_->destroy(&storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  std::aligned_storage_t<kInlineSize, alignof(std::max_align_t)> storage_;
+  const Ops *ops_ = nullptr;
+};
+
+} // namespace reanimated
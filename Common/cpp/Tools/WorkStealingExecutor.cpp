@@ -0,0 +1,92 @@
+#include "WorkStealingExecutor.h"
+
+#include <utility>
+
+namespace reanimated {
+
+WorkStealingExecutor::WorkStealingExecutor(
+    size_t workerCount,
+    WorkerHook onWorkerStart,
+    WorkerHook onWorkerStop)
+    : onWorkerStart_(std::move(onWorkerStart)),
+      onWorkerStop_(std::move(onWorkerStop)) {
+  workers_.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; i++) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  // Threads are started only once all the deques exist, since any worker may
+  // try to steal from any other one.
+  for (size_t i = 0; i < workerCount; i++) {
+    workers_[i]->thread = std::thread([this, i] { runWorker(i); });
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(idleMutex_);
+    stopped_ = true;
+  }
+  idleCondition_.notify_all();
+  for (auto &worker : workers_) {
+    worker->thread.join();
+  }
+}
+
+void WorkStealingExecutor::submit(Job job) {
+  auto &worker =
+      *workers_[nextWorker_.fetch_add(1, std::memory_order_relaxed) %
+                workers_.size()];
+  // The counter is bumped before the job becomes visible so that it never
+  // drops below the number of queued jobs.
+  pendingJobs_.fetch_add(1);
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.jobs.push_back(std::move(job));
+  }
+  {
+    // Taking the lock orders this notification after the check done by a
+    // worker that's about to go to sleep, so the wakeup can't get lost.
+    std::lock_guard<std::mutex> lock(idleMutex_);
+  }
+  idleCondition_.notify_one();
+}
+
+bool WorkStealingExecutor::takeJob(size_t workerIndex, Job &job) {
+  {
+    auto &own = *workers_[workerIndex];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.jobs.empty()) {
+      job = std::move(own.jobs.front());
+      own.jobs.pop_front();
+      return true;
+    }
+  }
+  for (size_t i = 1, size = workers_.size(); i < size; i++) {
+    auto &victim = *workers_[(workerIndex + i) % size];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.jobs.empty()) {
+      job = std::move(victim.jobs.back());
+      victim.jobs.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingExecutor::runWorker(size_t workerIndex) {
+  onWorkerStart_(workerIndex);
+  while (!stopped_) {
+    Job job;
+    if (takeJob(workerIndex, job)) {
+      pendingJobs_.fetch_sub(1);
+      job(workerIndex);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(idleMutex_);
+    idleCondition_.wait(
+        lock, [this] { return stopped_ || pendingJobs_.load() > 0; });
+  }
+  onWorkerStop_(workerIndex);
+}
+
+} // namespace reanimated
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "UniqueFunction.h"
+
+namespace reanimated {
+
+// Fixed-size thread pool where every worker owns a job deque. Submitted jobs
+// are spread round-robin between the deques, a worker takes jobs from the
+// front of its own deque and, once it runs dry, steals from the back of the
+// other workers' deques. Idle workers sleep until new jobs are submitted.
+//
+// Jobs receive the index of the worker that runs them, which lets callers keep
+// per-worker state (e.g. a jsi::Runtime) without any locking. Jobs must not
+// throw.
+class WorkStealingExecutor {
+ public:
+  using Job = UniqueFunction<void(size_t workerIndex)>;
+  using WorkerHook = std::function<void(size_t workerIndex)>;
+
+  // `onWorkerStart` and `onWorkerStop` are called on the worker's thread
+  // before it picks up its first job and after it finishes its last one.
+  WorkStealingExecutor(
+      size_t workerCount,
+      WorkerHook onWorkerStart,
+      WorkerHook onWorkerStop);
+  WorkStealingExecutor(const WorkStealingExecutor &) = delete;
+  WorkStealingExecutor &operator=(const WorkStealingExecutor &) = delete;
+
+  // Waits for the running jobs to finish and joins the workers. Jobs that
+  // haven't been started yet are dropped.
+  ~WorkStealingExecutor();
+
+  void submit(Job job);
+
+  inline size_t workerCount() const {
+    return workers_.size();
+  }
+
+ private:
+  struct Worker {
+    std::mutex mutex; // protects `jobs`
+    std::deque<Job> jobs;
+    std::thread thread;
+  };
+
+  bool takeJob(size_t workerIndex, Job &job);
+  void runWorker(size_t workerIndex);
+
+  const WorkerHook onWorkerStart_;
+  const WorkerHook onWorkerStop_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<size_t> nextWorker_{0};
+  std::atomic<size_t> pendingJobs_{0};
+  std::atomic<bool> stopped_{false};
+  std::mutex idleMutex_;
+  std::condition_variable idleCondition_;
+};
+
+} // namespace reanimated
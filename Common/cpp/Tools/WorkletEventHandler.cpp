@@ -1,4 +1,5 @@
 #include "WorkletEventHandler.h"
+#include "JSRuntimeHelper.h"
 
 namespace reanimated {
 
@@ -25,4 +26,18 @@ bool WorkletEventHandler::shouldIgnoreEmitterReactTag() const {
   return emitterReactTag_ == -1;
 }
 
+bool WorkletEventHandler::shouldConsumeEvent() const {
+  return shouldConsumeEvent_;
+}
+
+bool WorkletEventHandler::shouldCoalesceEvents() const {
+  return shouldCoalesceEvents_;
+}
+
+bool WorkletEventHandler::isContinuousEvent(const std::string &eventName) {
+  return eventName == "onScroll" || eventName == "onPageScroll" ||
+      eventName == "onGestureHandlerEvent" ||
+      eventName == "onTransitionProgress";
+}
+
 } // namespace reanimated
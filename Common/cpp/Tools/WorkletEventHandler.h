@@ -5,18 +5,20 @@
 #include <string>
 #include <utility>
 
-#include "Shareables.h"
-
 using namespace facebook;
 
 namespace reanimated {
 
+class JSRuntimeHelper;
+
 class WorkletEventHandler {
   const std::shared_ptr<JSRuntimeHelper> runtimeHelper_;
   const jsi::Value handlerFunction_;
   const uint64_t handlerId_;
   const std::string eventName_;
   const uint64_t emitterReactTag_;
+  const bool shouldConsumeEvent_;
+  const bool shouldCoalesceEvents_;
 
  public:
   WorkletEventHandler(
@@ -24,17 +26,33 @@ class WorkletEventHandler {
       const uint64_t handlerId,
       const std::string &eventName,
       const uint64_t emitterReactTag,
+      const bool shouldConsumeEvent,
+      const bool shouldCoalesceEvents,
       jsi::Value &&handlerFunction)
       : runtimeHelper_(runtimeHelper),
         handlerFunction_(std::move(handlerFunction)),
         handlerId_(handlerId),
         eventName_(eventName),
-        emitterReactTag_(emitterReactTag) {}
+        emitterReactTag_(emitterReactTag),
+        shouldConsumeEvent_(shouldConsumeEvent),
+        shouldCoalesceEvents_(
+            shouldCoalesceEvents && isContinuousEvent(eventName)) {}
   void process(double eventTimestamp, const jsi::Value &eventValue) const;
   uint64_t getHandlerId() const;
   const std::string &getEventName() const;
   uint64_t getEmitterReactTag() const;
   bool shouldIgnoreEmitterReactTag() const;
+  // whether the event doesn't have to be dispatched to React after the
+  // handler ran
+  bool shouldConsumeEvent() const;
+  // whether the handler runs once per frame with the latest event of every
+  // emitter instead of once per event, only ever true for continuous events
+  bool shouldCoalesceEvents() const;
+
+  // Whether only the latest of the events matters, e.g. scroll positions, as
+  // opposed to discrete events like gesture state changes, which handlers
+  // must see every one of and in order.
+  static bool isContinuousEvent(const std::string &eventName);
 };
 
 } // namespace reanimated
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace reanimated {
 
@@ -21,8 +22,10 @@ class UISchedulerWrapper : public UIScheduler {
       jni::global_ref<AndroidUIScheduler::javaobject> androidUiScheduler)
       : androidUiScheduler_(androidUiScheduler) {}
 
-  void scheduleOnUI(std::function<void()> job) override {
-    UIScheduler::scheduleOnUI(job);
+  void scheduleOnUI(
+      UniqueFunction<void()> job,
+      UIJobPriority priority = UIJobPriority::FrameCritical) override {
+    UIScheduler::scheduleOnUI(std::move(job), priority);
     if (!scheduledOnUI_) {
       scheduledOnUI_ = true;
       androidUiScheduler_->cthis()->scheduleTriggerOnUI();
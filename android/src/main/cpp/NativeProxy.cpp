@@ -3,13 +3,16 @@
 #include <jsi/JSIDynamic.h>
 #include <jsi/jsi.h>
 #include <react/jni/JMessageQueueThread.h>
+#include <react/jni/NativeMap.h>
 #include <react/jni/ReadableNativeArray.h>
 #include <react/jni/ReadableNativeMap.h>
 
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include "AndroidUIScheduler.h"
+#include "EventPayload.h"
 #include "JsiUtils.h"
 #include "LayoutAnimationsManager.h"
 #include "NativeProxy.h"
@@ -26,6 +29,51 @@ namespace reanimated {
 using namespace facebook;
 using namespace react;
 
+// Native maps are read through React Native's protected `NativeMap::map_`.
+// The supported range is 0.64 - 0.73, in which it holds the contents of the
+// map as `folly::dynamic`. Other versions, e.g. nightlies, take the JSON path
+// until they're checked as well.
+#if REACT_NATIVE_MINOR_VERSION >= 64 && REACT_NATIVE_MINOR_VERSION <= 73
+#define REANIMATED_READ_NATIVE_MAP 1
+#else
+#define REANIMATED_READ_NATIVE_MAP 0
+#endif
+
+namespace {
+
+#if REANIMATED_READ_NATIVE_MAP
+// Reads the contents of a native map without consuming it, React Native
+// dispatches the same map to JS after Reanimated.
+struct NativeMapAccessor : public NativeMap {
+  static_assert(
+      std::is_same_v<decltype(NativeMapAccessor::map_), folly::dynamic>,
+      "[Reanimated] NativeMap::map_ is no longer a folly::dynamic, update "
+      "REANIMATED_READ_NATIVE_MAP in NativeProxy.cpp");
+
+  static const folly::dynamic &getMap(const NativeMap &nativeMap) {
+    return nativeMap.*(&NativeMapAccessor::map_);
+  }
+};
+#endif // REANIMATED_READ_NATIVE_MAP
+
+// Returns the contents of `event` if it's a native map which can be read
+// directly, null otherwise.
+const folly::dynamic *getNativeMapContents(
+    jni::alias_ref<react::WritableMap> event) {
+#if REANIMATED_READ_NATIVE_MAP
+  if (event->isInstanceOf(ReadableNativeMap::javaClassStatic())) {
+    const auto *nativeMap =
+        jni::static_ref_cast<ReadableNativeMap::jhybridobject>(event)->cthis();
+    if (!nativeMap->isConsumed) {
+      return &NativeMapAccessor::getMap(*nativeMap);
+    }
+  }
+#endif // REANIMATED_READ_NATIVE_MAP
+  return nullptr;
+}
+
+} // namespace
+
 NativeProxy::NativeProxy(
     jni::alias_ref<NativeProxy::javaobject> jThis,
     jsi::Runtime *rnRuntime,
@@ -297,13 +345,12 @@ inline jni::local_ref<ReadableMap::javaobject> castReadableMap(
 void NativeProxy::synchronouslyUpdateUIProps(
     jsi::Runtime &rt,
     Tag tag,
-    const jsi::Object &props) {
+    const folly::dynamic &props) {
   static const auto method =
       getJniMethod<void(int, jni::local_ref<ReadableMap::javaobject>)>(
           "synchronouslyUpdateUIProps");
   jni::local_ref<ReadableMap::javaobject> uiProps =
-      castReadableMap(ReadableNativeMap::newObjectCxxArgs(
-          jsi::dynamicFromValue(rt, jsi::Value(rt, props))));
+      castReadableMap(ReadableNativeMap::newObjectCxxArgs(props));
   method(javaPart_.get(), tag, uiProps);
 }
 #endif
@@ -357,48 +404,59 @@ double NativeProxy::getCurrentTime() {
   return static_cast<double>(output);
 }
 
-void NativeProxy::handleEvent(
+bool NativeProxy::handleEvent(
     jni::alias_ref<JString> eventName,
     jint emitterReactTag,
     jni::alias_ref<react::WritableMap> event) {
   // handles RCTEvents from RNGestureHandler
   if (event.get() == nullptr) {
     // Ignore events with null payload.
-    return;
-  }
-  // TODO: convert event directly to jsi::Value without JSON serialization
-  std::string eventAsString;
-  try {
-    eventAsString = event->toString();
-  } catch (std::exception &) {
-    // Events from other libraries may contain NaN or INF values which
-    // cannot be represented in JSON. See
-    // https://github.com/software-mansion/react-native-reanimated/issues/1776
-    // for details.
-    return;
-  }
-#if REACT_NATIVE_MINOR_VERSION >= 72
-  std::string eventJSON = eventAsString;
-#else
-  // remove "{ NativeMap: " and " }"
-  std::string eventJSON = eventAsString.substr(13, eventAsString.length() - 15);
-#endif
-  if (eventJSON == "null") {
-    return;
+    return false;
   }
 
   jsi::Runtime &rt = *nativeReanimatedModule_->runtimeManager_->runtime;
   jsi::Value payload;
-  try {
-    payload = jsi::Value::createFromJsonUtf8(
-        rt, reinterpret_cast<uint8_t *>(&eventJSON[0]), eventJSON.size());
-  } catch (std::exception &) {
-    // Ignore events with malformed JSON payload.
-    return;
+  if (const auto *map = getNativeMapContents(event)) {
+    // Events are almost always native maps, which are converted straight
+    // from their `folly::dynamic`, without JSON serialization.
+    if (map->isNull()) {
+      return false;
+    }
+    payload = eventPayloadFromDynamic(rt, *map);
+  } else {
+    std::string eventAsString;
+    try {
+      eventAsString = event->toString();
+    } catch (std::exception &) {
+      // Events from other libraries may contain NaN or INF values which
+      // cannot be represented in JSON. See
+      // https://github.com/software-mansion/react-native-reanimated/issues/1776
+      // for details.
+      return false;
+    }
+#if REACT_NATIVE_MINOR_VERSION >= 72
+    std::string eventJSON = eventAsString;
+#else
+    // remove "{ NativeMap: " and " }"
+    std::string eventJSON =
+        eventAsString.substr(13, eventAsString.length() - 15);
+#endif
+    if (eventJSON == "null") {
+      return false;
+    }
+
+    try {
+      payload = jsi::Value::createFromJsonUtf8(
+          rt, reinterpret_cast<uint8_t *>(&eventJSON[0]), eventJSON.size());
+    } catch (std::exception &) {
+      // Ignore events with malformed JSON payload.
+      return false;
+    }
   }
 
-  nativeReanimatedModule_->handleEvent(
+  const auto result = nativeReanimatedModule_->handleEvent(
       eventName->toString(), emitterReactTag, payload, this->getCurrentTime());
+  return result.ranWorklets;
 }
 
 void NativeProxy::progressLayoutAnimation(
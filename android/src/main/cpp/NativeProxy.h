@@ -64,11 +64,11 @@ class EventHandler : public HybridClass<EventHandler> {
   static auto constexpr kJavaDescriptor =
       "Lcom/swmansion/reanimated/nativeProxy/EventHandler;";
 
-  void receiveEvent(
+  bool receiveEvent(
       jni::alias_ref<JString> eventKey,
       jint emitterReactTag,
       jni::alias_ref<react::WritableMap> event) {
-    handler_(eventKey, emitterReactTag, event);
+    return handler_(eventKey, emitterReactTag, event);
   }
 
   static void registerNatives() {
@@ -80,14 +80,14 @@ class EventHandler : public HybridClass<EventHandler> {
  private:
   friend HybridBase;
 
-  explicit EventHandler(std::function<void(
+  explicit EventHandler(std::function<bool(
                             jni::alias_ref<JString>,
                             jint emitterReactTag,
                             jni::alias_ref<react::WritableMap>)> handler)
       : handler_(std::move(handler)) {}
 
   std::function<
-      void(jni::alias_ref<JString>, jint, jni::alias_ref<react::WritableMap>)>
+      bool(jni::alias_ref<JString>, jint, jni::alias_ref<react::WritableMap>)>
       handler_;
 };
 
@@ -192,7 +192,7 @@ class NativeProxy : public jni::HybridClass<NativeProxy> {
   void synchronouslyUpdateUIProps(
       jsi::Runtime &rt,
       Tag viewTag,
-      const jsi::Object &props);
+      const folly::dynamic &props);
 #else
   void installJSIBindings(
       jni::alias_ref<JavaMessageQueueThread::javaobject> messageQueueThread);
@@ -238,7 +238,8 @@ class NativeProxy : public jni::HybridClass<NativeProxy> {
       const jsi::Value &argsValue);
   std::vector<std::pair<std::string, double>> measure(int viewTag);
 #endif
-  void handleEvent(
+  // Returns whether a worklet ran, so that there are updates to perform.
+  bool handleEvent(
       jni::alias_ref<JString> eventName,
       jint emitterReactTag,
       jni::alias_ref<react::WritableMap> event);
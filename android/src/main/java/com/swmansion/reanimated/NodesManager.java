@@ -25,9 +25,8 @@ import com.facebook.react.uimanager.UIManagerModule;
 import com.facebook.react.uimanager.UIManagerReanimatedHelper;
 import com.facebook.react.uimanager.events.Event;
 import com.facebook.react.uimanager.events.EventDispatcherListener;
-import com.facebook.react.uimanager.events.RCTEventEmitter;
 import com.swmansion.reanimated.layoutReanimation.AnimationsManager;
-import com.swmansion.reanimated.nativeProxy.NoopEventHandler;
+import com.swmansion.reanimated.nativeProxy.EventHandler;
 import java.util.ArrayList;
 import java.util.Collections;
 import java.util.LinkedList;
@@ -91,7 +90,7 @@ public class NodesManager implements EventDispatcherListener {
   private final ReactContext mContext;
   private final UIManagerModule mUIManager;
   private ReactApplicationContext mReactApplicationContext;
-  private RCTEventEmitter mCustomEventHandler = new NoopEventHandler();
+  private @Nullable EventHandler mCustomEventHandler;
   private List<OnAnimationFrame> mFrameCallbacks = new ArrayList<>();
   private ConcurrentLinkedQueue<CopiedEvent> mEventQueue = new ConcurrentLinkedQueue<>();
   private double lastFrameTimeMs;
@@ -256,10 +255,12 @@ public class NodesManager implements EventDispatcherListener {
       // due to frame drops. If this occurs, the additional callback execution should be ignored.
       lastFrameTimeMs = currentFrameTimeMs;
 
+      boolean ranWorklets = false;
       while (!mEventQueue.isEmpty()) {
         CopiedEvent copiedEvent = mEventQueue.poll();
-        handleEvent(
-            copiedEvent.getTargetTag(), copiedEvent.getEventName(), copiedEvent.getPayload());
+        ranWorklets |=
+            handleEvent(
+                copiedEvent.getTargetTag(), copiedEvent.getEventName(), copiedEvent.getPayload());
       }
 
       if (!mFrameCallbacks.isEmpty()) {
@@ -268,9 +269,12 @@ public class NodesManager implements EventDispatcherListener {
         for (int i = 0, size = frameCallbacks.size(); i < size; i++) {
           frameCallbacks.get(i).onAnimationFrame(currentFrameTimeMs);
         }
+        ranWorklets = true;
       }
 
-      performOperations();
+      if (ranWorklets) {
+        performOperations();
+      }
     }
 
     mCallbackPosted.set(false);
@@ -305,8 +309,10 @@ public class NodesManager implements EventDispatcherListener {
     // Events can be dispatched from any thread so we have to make sure handleEvent is run from the
     // UI thread.
     if (UiThreadUtil.isOnUiThread()) {
-      handleEvent(event);
-      performOperations();
+      if (handleEvent(event)) {
+        // otherwise no worklet ran and there are no updates to perform
+        performOperations();
+      }
     } else {
       boolean shouldSaveEvent = false;
       String eventName = mCustomEventNamesResolver.resolveCustomEventName(event.getEventName());
@@ -321,19 +327,27 @@ public class NodesManager implements EventDispatcherListener {
     }
   }
 
-  private void handleEvent(Event event) {
+  private boolean handleEvent(Event event) {
+    if (mCustomEventHandler == null) {
+      return false;
+    }
     event.dispatch(mCustomEventHandler);
+    return mCustomEventHandler.takeRanWorklets();
   }
 
-  private void handleEvent(int targetTag, String eventName, @Nullable WritableMap event) {
+  private boolean handleEvent(int targetTag, String eventName, @Nullable WritableMap event) {
+    if (mCustomEventHandler == null) {
+      return false;
+    }
     mCustomEventHandler.receiveEvent(targetTag, eventName, event);
+    return mCustomEventHandler.takeRanWorklets();
   }
 
   public UIManagerModule.CustomEventNamesResolver getEventNameResolver() {
     return mCustomEventNamesResolver;
   }
 
-  public void registerEventHandler(RCTEventEmitter handler) {
+  public void registerEventHandler(EventHandler handler) {
     mCustomEventHandler = handler;
   }
 
@@ -13,6 +13,7 @@ public class EventHandler implements RCTEventEmitter {
 
   @DoNotStrip private final HybridData mHybridData;
   UIManagerModule.CustomEventNamesResolver mCustomEventNamesResolver;
+  private boolean mRanWorklets = false;
 
   @DoNotStrip
   private EventHandler(HybridData hybridData) {
@@ -22,10 +23,20 @@ public class EventHandler implements RCTEventEmitter {
   @Override
   public void receiveEvent(int emitterReactTag, String eventName, @Nullable WritableMap event) {
     String resolvedEventName = mCustomEventNamesResolver.resolveCustomEventName(eventName);
-    receiveEvent(resolvedEventName, emitterReactTag, event);
+    mRanWorklets |= receiveEvent(resolvedEventName, emitterReactTag, event);
   }
 
-  public native void receiveEvent(
+  /**
+   * Returns whether a worklet ran since the last call, so that there are updates to perform. Events
+   * are dispatched through {@link RCTEventEmitter}, which doesn't return anything.
+   */
+  public boolean takeRanWorklets() {
+    boolean ranWorklets = mRanWorklets;
+    mRanWorklets = false;
+    return ranWorklets;
+  }
+
+  public native boolean receiveEvent(
       String eventName, int emitterReactTag, @Nullable WritableMap event);
 
   @Override
@@ -11,7 +11,8 @@
 
 typedef void (^REAOnAnimationCallback)(READisplayLink *displayLink);
 typedef void (^REANativeAnimationOp)(RCTUIManager *uiManager);
-typedef void (^REAEventHandler)(id<RCTEvent> event);
+// Returns whether a worklet ran, so that there are updates to perform.
+typedef BOOL (^REAEventHandler)(id<RCTEvent> event);
 typedef void (^CADisplayLinkOperation)(READisplayLink *displayLink);
 
 #ifdef RCT_NEW_ARCH_ENABLED
@@ -215,8 +215,9 @@ using namespace facebook::react;
     _operationsInBatch = [NSMutableDictionary new];
     _componentUpdateBuffer = [NSMutableDictionary new];
     _viewRegistry = [_uiManager valueForKey:@"_viewRegistry"];
-    _eventHandler = ^(id<RCTEvent> event) {
+    _eventHandler = ^BOOL(id<RCTEvent> event) {
       // no-op
+      return NO;
     };
   }
 #else
@@ -395,8 +396,10 @@ using namespace facebook::react;
     if (eventHandler == nil) {
       return;
     }
-    eventHandler(event);
-    [strongSelf performOperations];
+    if (eventHandler(event)) {
+      // otherwise no worklet ran and there are no updates to perform
+      [strongSelf performOperations];
+    }
   });
 }
 
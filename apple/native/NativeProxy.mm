@@ -19,6 +19,7 @@
 
 #ifdef RCT_NEW_ARCH_ENABLED
 #import <React/RCTBridge+Private.h>
+#import <React/RCTFollyConvert.h>
 #import <React/RCTScheduler.h>
 #import <React/RCTSurfacePresenter.h>
 #import <react/renderer/core/ShadowNode.h>
@@ -191,9 +192,9 @@ std::shared_ptr<NativeReanimatedModule> createReanimatedModule(
   };
 
 #ifdef RCT_NEW_ARCH_ENABLED
-  auto synchronouslyUpdateUIPropsFunction = [nodesManager](jsi::Runtime &rt, Tag tag, const jsi::Object &props) {
+  auto synchronouslyUpdateUIPropsFunction = [nodesManager](jsi::Runtime &rt, Tag tag, const folly::dynamic &props) {
     NSNumber *viewTag = @(tag);
-    NSDictionary *uiProps = convertJSIObjectToNSDictionary(rt, props);
+    NSDictionary *uiProps = convertFollyDynamicToId(props);
     [nodesManager synchronouslyUpdateViewOnUIThread:viewTag props:uiProps];
   };
 
@@ -293,7 +294,7 @@ std::shared_ptr<NativeReanimatedModule> createReanimatedModule(
 
   uiScheduler->setRuntimeManager(nativeReanimatedModule->runtimeManager_);
 
-  [reaModule.nodesManager registerEventHandler:^(id<RCTEvent> event) {
+  [reaModule.nodesManager registerEventHandler:^BOOL(id<RCTEvent> event) {
     // handles RCTEvents from RNGestureHandler
     std::string eventName = [event.eventName UTF8String];
     int emitterReactTag = [event.viewTag intValue];
@@ -301,7 +302,8 @@ std::shared_ptr<NativeReanimatedModule> createReanimatedModule(
     jsi::Runtime &rt = *nativeReanimatedModule->runtimeManager_->runtime;
     jsi::Value payload = convertObjCObjectToJSIValue(rt, eventData);
     double currentTime = CACurrentMediaTime() * 1000;
-    nativeReanimatedModule->handleEvent(eventName, emitterReactTag, payload, currentTime);
+    const auto result = nativeReanimatedModule->handleEvent(eventName, emitterReactTag, payload, currentTime);
+    return result.ranWorklets;
   }];
 
   std::weak_ptr<NativeReanimatedModule> weakNativeReanimatedModule = nativeReanimatedModule; // to avoid retain cycle
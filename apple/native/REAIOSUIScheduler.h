@@ -11,7 +11,7 @@ using namespace react;
 
 class REAIOSUIScheduler : public UIScheduler {
  public:
-  void scheduleOnUI(std::function<void()> job) override;
+  void scheduleOnUI(UniqueFunction<void()> job, UIJobPriority priority = UIJobPriority::FrameCritical) override;
 };
 
 } // namespace reanimated
@@ -1,24 +1,26 @@
 #import <RNReanimated/REAIOSUIScheduler.h>
 #import <RNReanimated/RuntimeManager.h>
 
+#include <utility>
+
 namespace reanimated {
 
 using namespace facebook;
 using namespace react;
 
-void REAIOSUIScheduler::scheduleOnUI(std::function<void()> job)
+void REAIOSUIScheduler::scheduleOnUI(UniqueFunction<void()> job, UIJobPriority priority)
 {
   const auto runtimeManager = weakRuntimeManager_.lock();
   if (!runtimeManager) {
     return;
   }
 
-  if ([NSThread isMainThread]) {
+  if ([NSThread isMainThread] && priority == UIJobPriority::FrameCritical) {
     job();
     return;
   }
 
-  UIScheduler::scheduleOnUI(job);
+  UIScheduler::scheduleOnUI(std::move(job), priority);
 
   if (!scheduledOnUI_) {
     __block std::weak_ptr<RuntimeManager> blockRuntimeManager = weakRuntimeManager_;
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "AncestorPathCache.h"
+#include "ShadowTreeModel.h"
+
+using namespace reanimated;
+using namespace reanimated::model;
+
+namespace {
+
+// `views` animated views, each at the end of its own chain of `depth` nodes
+// with `siblings` static nodes before the chain on every level.
+struct Tree {
+  ShadowNode::Shared root;
+  std::vector<ShadowNodeFamily::Shared> families;
+};
+
+Tree makeTree(int depth, int siblings, int views) {
+  Tree tree;
+  Tag nextTag = 1;
+  ShadowNode::ListOfShared chains;
+  for (int i = 0; i < views; ++i) {
+    auto family = makeFamily(nextTag++);
+    tree.families.push_back(family);
+    chains.push_back(makeChain(depth, siblings, makeNode(family), nextTag));
+  }
+  tree.root = makeNode(nextTag++, std::move(chains));
+  tree.root->sealRecursive();
+  return tree;
+}
+
+void BM_GetAncestors(benchmark::State &state) {
+  const auto tree = makeTree(state.range(0), state.range(1), state.range(2));
+  for (auto _ : state) {
+    for (const auto &family : tree.families) {
+      benchmark::DoNotOptimize(family->getAncestors(*tree.root));
+    }
+  }
+}
+
+void BM_AncestorPathCache(benchmark::State &state) {
+  const auto tree = makeTree(state.range(0), state.range(1), state.range(2));
+  AncestorPathCache cache;
+  for (auto _ : state) {
+    for (const auto &family : tree.families) {
+      benchmark::DoNotOptimize(cache.getAncestors(*family, *tree.root));
+    }
+  }
+  const auto stats = cache.getStats();
+  state.counters["hits"] = static_cast<double>(stats.hits);
+  state.counters["misses"] = static_cast<double>(stats.misses);
+}
+
+// depth, static siblings per level, animated views; one iteration is a frame
+void treeShapes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->Args({10, 5, 50})->Args({40, 10, 50})->Args({80, 20, 20});
+  benchmark->Unit(benchmark::kMicrosecond);
+}
+
+} // namespace
+
+BENCHMARK(BM_GetAncestors)->Apply(treeShapes);
+BENCHMARK(BM_AncestorPathCache)->Apply(treeShapes);
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "AncestorPathCache.h"
+#include "ShadowTreeModel.h"
+
+using namespace reanimated;
+using namespace reanimated::model;
+
+namespace {
+
+// (tag of the ancestor, child index) pairs, comparable across trees
+std::vector<std::pair<Tag, int>> toTags(
+    const ShadowNodeFamily::AncestorList &ancestors) {
+  std::vector<std::pair<Tag, int>> result;
+  for (const auto &[node, index] : ancestors) {
+    result.emplace_back(node.get().getTag(), index);
+  }
+  return result;
+}
+
+class AncestorPathCacheTest : public ::testing::Test {
+ protected:
+  void expectAncestors(
+      const ShadowNodeFamily &family,
+      const ShadowNode &root,
+      uint64_t hits,
+      uint64_t misses) {
+    EXPECT_EQ(
+        toTags(cache_.getAncestors(family, root)),
+        toTags(family.getAncestors(root)));
+    EXPECT_EQ(cache_.getStats().hits, hits);
+    EXPECT_EQ(cache_.getStats().misses, misses);
+  }
+
+  AncestorPathCache cache_;
+};
+
+TEST_F(AncestorPathCacheTest, RemembersThePath) {
+  const auto view = makeFamily(1);
+  const auto root = makeNode(
+      2, {makeNode(3), makeNode(4, {makeNode(5), makeNode(view)})});
+
+  expectAncestors(*view, *root, 0, 1);
+  expectAncestors(*view, *root, 1, 1);
+  EXPECT_EQ(
+      toTags(cache_.getAncestors(*view, *root)),
+      (std::vector<std::pair<Tag, int>>{{2, 1}, {4, 1}}));
+}
+
+TEST_F(AncestorPathCacheTest, RejectsThePathWhenASiblingIsInserted) {
+  const auto view = makeFamily(1);
+  const auto parent = makeFamily(2);
+  const auto root = makeNode(3, {makeNode(parent, {makeNode(view)})});
+  expectAncestors(*view, *root, 0, 1);
+
+  // the remembered path now leads to the new sibling
+  const auto newRoot = makeNode(
+      3, {makeNode(parent, {makeNode(4), makeNode(view)})});
+  expectAncestors(*view, *newRoot, 0, 2);
+  expectAncestors(*view, *newRoot, 1, 2);
+}
+
+TEST_F(AncestorPathCacheTest, RejectsThePathWhenTheViewMoves) {
+  const auto view = makeFamily(1);
+  const auto first = makeFamily(2);
+  const auto second = makeFamily(3);
+  const auto root = makeNode(
+      4, {makeNode(first, {makeNode(view)}), makeNode(second, {makeNode(5)})});
+  expectAncestors(*view, *root, 0, 1);
+
+  // The view moves to the other parent, which keeps the child indices of the
+  // remembered path valid.
+  const auto newRoot = makeNode(
+      4, {makeNode(first, {makeNode(5)}), makeNode(second, {makeNode(view)})});
+  expectAncestors(*view, *newRoot, 0, 2);
+  EXPECT_EQ(
+      toTags(cache_.getAncestors(*view, *newRoot)),
+      (std::vector<std::pair<Tag, int>>{{4, 1}, {3, 0}}));
+  EXPECT_EQ(cache_.getStats().hits, 1u);
+}
+
+TEST_F(AncestorPathCacheTest, RejectsThePathWhenTheViewMovesUp) {
+  const auto view = makeFamily(1);
+  const auto root =
+      makeNode(2, {makeNode(3, {makeNode(4, {makeNode(view)})})});
+  expectAncestors(*view, *root, 0, 1);
+
+  // the remembered path is now longer than the tree is deep
+  const auto newRoot = makeNode(2, {makeNode(3, {makeNode(view)})});
+  expectAncestors(*view, *newRoot, 0, 2);
+}
+
+TEST_F(AncestorPathCacheTest, RejectsThePathToAViewReusingTheTag) {
+  const auto view = makeFamily(1);
+  const auto root = makeNode(2, {makeNode(view)});
+  expectAncestors(*view, *root, 0, 1);
+
+  // a new view with the same tag at the remembered path
+  const auto newView = makeFamily(1);
+  const auto newRoot = makeNode(2, {makeNode(newView), makeNode(view)});
+  expectAncestors(*view, *newRoot, 0, 2);
+}
+
+TEST_F(AncestorPathCacheTest, ForgetsViewsRemovedFromTheTree) {
+  const auto view = makeFamily(1);
+  const auto parent = makeFamily(2);
+  const auto root = makeNode(3, {makeNode(parent, {makeNode(view)})});
+  expectAncestors(*view, *root, 0, 1);
+
+  const auto newRoot = makeNode(3, {makeNode(parent)});
+  EXPECT_TRUE(cache_.getAncestors(*view, *newRoot).empty());
+  // the path isn't tried again
+  EXPECT_TRUE(cache_.getAncestors(*view, *newRoot).empty());
+  EXPECT_EQ(cache_.getStats().hits, 0u);
+  EXPECT_EQ(cache_.getStats().misses, 3u);
+}
+
+TEST_F(AncestorPathCacheTest, RemovesPaths) {
+  const auto view = makeFamily(1);
+  const auto root = makeNode(2, {makeNode(view)});
+  expectAncestors(*view, *root, 0, 1);
+  cache_.remove(view->getTag());
+  expectAncestors(*view, *root, 0, 2);
+}
+
+} // namespace
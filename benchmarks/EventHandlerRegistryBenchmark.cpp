@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "EventHandlerRegistry.h"
+#include "JSRuntimeHelper.h"
+#include "WorkletEventHandler.h"
+
+using namespace reanimated;
+
+namespace {
+
+// Routes events the way EventHandlerRegistry did before events were routed
+// through interned ids: ordered maps keyed by the event name, behind a mutex.
+class LockedEventHandlerRegistry {
+ public:
+  void registerEventHandler(std::shared_ptr<WorkletEventHandler> eventHandler) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto &eventName = eventHandler->getEventName();
+    const auto handlerId = eventHandler->getHandlerId();
+    if (eventHandler->shouldIgnoreEmitterReactTag()) {
+      mappingsWithoutTag_[eventName][handlerId] = std::move(eventHandler);
+    } else {
+      const auto eventHash = std::make_pair(
+          static_cast<int>(eventHandler->getEmitterReactTag()), eventName);
+      mappingsWithTag_[eventHash][handlerId] = std::move(eventHandler);
+    }
+  }
+
+  EventHandlingResult processEvent(
+      jsi::Runtime &rt,
+      double eventTimestamp,
+      const std::string &eventName,
+      const int emitterReactTag,
+      const jsi::Value &eventPayload) {
+    std::vector<std::shared_ptr<WorkletEventHandler>> handlersForEvent;
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      const auto handlersIt = mappingsWithoutTag_.find(eventName);
+      if (handlersIt != mappingsWithoutTag_.end()) {
+        for (const auto &handler : handlersIt->second) {
+          handlersForEvent.push_back(handler.second);
+        }
+      }
+      const auto handlersWithTagIt =
+          mappingsWithTag_.find(std::make_pair(emitterReactTag, eventName));
+      if (handlersWithTagIt != mappingsWithTag_.end()) {
+        for (const auto &handler : handlersWithTagIt->second) {
+          handlersForEvent.push_back(handler.second);
+        }
+      }
+    }
+    if (handlersForEvent.empty()) {
+      return {};
+    }
+    eventPayload.asObject(rt).setProperty(
+        rt, "eventName", jsi::String::createFromUtf8(rt, eventName));
+    for (const auto &handler : handlersForEvent) {
+      handler->process(eventTimestamp, eventPayload);
+    }
+    return {false, true};
+  }
+
+  bool isAnyHandlerWaitingForEvent(
+      const std::string &eventName,
+      const int emitterReactTag) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto it =
+        mappingsWithTag_.find(std::make_pair(emitterReactTag, eventName));
+    return it != mappingsWithTag_.end() && !it->second.empty();
+  }
+
+ private:
+  using HandlersById =
+      std::unordered_map<uint64_t, std::shared_ptr<WorkletEventHandler>>;
+
+  std::map<std::pair<int, std::string>, HandlersById> mappingsWithTag_;
+  std::map<std::string, HandlersById> mappingsWithoutTag_;
+  std::mutex mutex_;
+};
+
+constexpr int kHandlers = 1000;
+constexpr int kTaggedHandlers = 900;
+constexpr int kUntaggedEventNames = 20;
+
+struct Event {
+  std::string name;
+  int emitterReactTag;
+};
+
+// `kTaggedHandlers` handlers of scroll and gesture events on their own views,
+// the rest ignore the emitter and listen to one of `kUntaggedEventNames`
+// custom events, like the shared transition progress.
+template <typename Registry>
+void registerHandlers(
+    Registry &registry,
+    const std::shared_ptr<JSRuntimeHelper> &runtimeHelper) {
+  for (int i = 0; i < kHandlers; ++i) {
+    const bool isTagged = i < kTaggedHandlers;
+    registry.registerEventHandler(std::make_shared<WorkletEventHandler>(
+        runtimeHelper,
+        i + 1,
+        isTagged ? (i % 2 == 0 ? "onScroll" : "onGestureHandlerEvent")
+                 : "onCustomEvent" + std::to_string(i % kUntaggedEventNames),
+        isTagged ? i + 1 : -1,
+        false,
+        false,
+        jsi::Value(static_cast<double>(i + 1))));
+  }
+}
+
+// A quarter of the events goes to tagged handlers and a quarter to untagged
+// ones. The rest has no handler: half of them are scroll events of views
+// without a handler, the others events which nobody listens to.
+std::vector<Event> makeEvents() {
+  std::vector<Event> events;
+  for (int i = 0; i < 1024; ++i) {
+    switch (i % 8) {
+      case 0:
+      case 1: {
+        const int handler = (i * 7) % kTaggedHandlers;
+        events.push_back(
+            {handler % 2 == 0 ? "onScroll" : "onGestureHandlerEvent",
+             handler + 1});
+        break;
+      }
+      case 2:
+      case 3:
+        events.push_back(
+            {"onCustomEvent" + std::to_string(i % kUntaggedEventNames),
+             kHandlers + i});
+        break;
+      case 4:
+      case 5:
+        events.push_back({"onScroll", kHandlers + i});
+        break;
+      default:
+        events.push_back({"onLayout", i % kTaggedHandlers + 1});
+        break;
+    }
+  }
+  return events;
+}
+
+template <typename Registry>
+void BM_ProcessEvent(benchmark::State &state) {
+  jsi::Runtime rt;
+  auto runtimeHelper = std::make_shared<JSRuntimeHelper>();
+  size_t handlersRun = 0;
+  runtimeHelper->onRun = [&](const jsi::Value &,
+                             const jsi::Value &,
+                             const jsi::Value &) { ++handlersRun; };
+  Registry registry;
+  registerHandlers(registry, runtimeHelper);
+  const auto events = makeEvents();
+  const jsi::Value payload(jsi::Object{rt});
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &event = events[i++ % events.size()];
+    benchmark::DoNotOptimize(registry.processEvent(
+        rt, 0, event.name, event.emitterReactTag, payload));
+  }
+  benchmark::DoNotOptimize(handlersRun);
+}
+
+// Run from several threads at once, like Android's event dispatcher asking
+// whether events from other threads have to be copied for the UI thread.
+template <typename Registry>
+void BM_IsAnyHandlerWaitingForEvent(benchmark::State &state) {
+  static Registry registry;
+  static std::once_flag registered;
+  std::call_once(registered, [] {
+    registerHandlers(registry, std::make_shared<JSRuntimeHelper>());
+  });
+  const auto events = makeEvents();
+
+  size_t i = state.thread_index() * 16;
+  for (auto _ : state) {
+    const auto &event = events[i++ % events.size()];
+    benchmark::DoNotOptimize(registry.isAnyHandlerWaitingForEvent(
+        event.name, event.emitterReactTag));
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_ProcessEvent, LockedEventHandlerRegistry);
+BENCHMARK_TEMPLATE(BM_ProcessEvent, EventHandlerRegistry);
+BENCHMARK_TEMPLATE(BM_IsAnyHandlerWaitingForEvent, LockedEventHandlerRegistry)
+    ->ThreadRange(1, 4);
+BENCHMARK_TEMPLATE(BM_IsAnyHandlerWaitingForEvent, EventHandlerRegistry)
+    ->ThreadRange(1, 4);
+
+} // namespace
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EventHandlerRegistry.h"
+#include "JSRuntimeHelper.h"
+#include "WorkletEventHandler.h"
+
+using namespace reanimated;
+
+namespace {
+
+// What a handler saw when it ran.
+struct HandlerRun {
+  uint64_t handlerId;
+  std::string eventName;
+  double x;
+  double droppedEventsCount;
+
+  bool operator==(const HandlerRun &other) const {
+    return handlerId == other.handlerId && eventName == other.eventName &&
+        x == other.x && droppedEventsCount == other.droppedEventsCount;
+  }
+};
+
+void PrintTo(const HandlerRun &run, std::ostream *os) {
+  *os << "{" << run.handlerId << ", " << run.eventName << ", x: " << run.x
+      << ", dropped: " << run.droppedEventsCount << "}";
+}
+
+class EventHandlerRegistryTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    runtimeHelper_->onRun = [this](
+                                const jsi::Value &function,
+                                const jsi::Value &,
+                                const jsi::Value &event) {
+      const auto object = event.asObject(rt_);
+      const auto droppedEventsCount =
+          object.getProperty(rt_, "droppedEventsCount");
+      runs_.push_back(HandlerRun{
+          static_cast<uint64_t>(function.getNumber()),
+          object.getProperty(rt_, "eventName").asString(rt_).utf8(rt_),
+          object.getProperty(rt_, "x").asNumber(),
+          droppedEventsCount.isNumber() ? droppedEventsCount.getNumber()
+                                        : -1});
+    };
+  }
+
+  // Handlers are passed their id instead of a worklet.
+  std::shared_ptr<WorkletEventHandler> makeHandler(
+      uint64_t handlerId,
+      const std::string &eventName,
+      int emitterReactTag,
+      bool shouldCoalesceEvents = false) {
+    return std::make_shared<WorkletEventHandler>(
+        runtimeHelper_,
+        handlerId,
+        eventName,
+        emitterReactTag,
+        false,
+        shouldCoalesceEvents,
+        jsi::Value(static_cast<double>(handlerId)));
+  }
+
+  EventHandlingResult
+  dispatch(const std::string &eventName, int emitterReactTag, double x) {
+    jsi::Object payload(rt_);
+    payload.setProperty(rt_, "x", x);
+    return registry_.processEvent(
+        rt_, 0, eventName, emitterReactTag, jsi::Value(std::move(payload)));
+  }
+
+  jsi::Runtime rt_;
+  std::shared_ptr<JSRuntimeHelper> runtimeHelper_ =
+      std::make_shared<JSRuntimeHelper>();
+  EventHandlerRegistry registry_;
+  std::vector<HandlerRun> runs_;
+};
+
+TEST_F(EventHandlerRegistryTest, FindsRegisteredHandlers) {
+  registry_.registerEventHandler(makeHandler(1, "onScroll", 10));
+  EXPECT_TRUE(registry_.isAnyHandlerWaitingForEvent("onScroll", 10));
+  EXPECT_FALSE(registry_.isAnyHandlerWaitingForEvent("onScroll", 11));
+  EXPECT_FALSE(registry_.isAnyHandlerWaitingForEvent("onLayout", 10));
+
+  registry_.unregisterEventHandler(1);
+  EXPECT_FALSE(registry_.isAnyHandlerWaitingForEvent("onScroll", 10));
+}
+
+TEST_F(EventHandlerRegistryTest, FreesReplacedRoutingsOnCollection) {
+  EXPECT_FALSE(registry_.hasRetiredRoutings());
+  registry_.registerEventHandler(makeHandler(1, "onScroll", 10));
+  registry_.unregisterEventHandler(1);
+  EXPECT_TRUE(registry_.hasRetiredRoutings());
+
+  registry_.collectRetiredRoutings();
+  EXPECT_FALSE(registry_.hasRetiredRoutings());
+}
+
+// Like Android's event dispatcher, which asks from other threads whether
+// events have to be copied for the UI thread.
+TEST_F(EventHandlerRegistryTest, LooksUpFromOtherThreadsWhileHandlersChange) {
+  std::atomic<bool> done{false};
+  std::thread reader([&] {
+    while (!done) {
+      registry_.isAnyHandlerWaitingForEvent("onScroll", 10);
+    }
+  });
+
+  for (int frame = 0; frame < 100; ++frame) {
+    for (uint64_t id = 1; id <= 20; ++id) {
+      registry_.registerEventHandler(
+          makeHandler(id, "onScroll", static_cast<int>(id % 20)));
+    }
+    for (uint64_t id = 1; id <= 20; ++id) {
+      registry_.unregisterEventHandler(id);
+    }
+    registry_.collectRetiredRoutings();
+  }
+
+  done = true;
+  reader.join();
+  registry_.collectRetiredRoutings();
+  EXPECT_FALSE(registry_.hasRetiredRoutings());
+  EXPECT_FALSE(registry_.isAnyHandlerWaitingForEvent("onScroll", 10));
+}
+
+TEST_F(EventHandlerRegistryTest, CoalescesContinuousEvents) {
+  registry_.registerEventHandler(
+      makeHandler(1, "onGestureHandlerEvent", 10, true));
+  dispatch("onGestureHandlerEvent", 10, 1);
+  dispatch("onGestureHandlerEvent", 10, 2);
+  dispatch("onGestureHandlerEvent", 10, 3);
+  EXPECT_TRUE(runs_.empty());
+
+  registry_.flushCoalescedEvents(rt_);
+  EXPECT_EQ(
+      runs_, (std::vector<HandlerRun>{{1, "onGestureHandlerEvent", 3, 2}}));
+  EXPECT_FALSE(registry_.hasCoalescedEvents());
+}
+
+TEST_F(EventHandlerRegistryTest, ReportsWhetherAWorkletRan) {
+  registry_.registerEventHandler(makeHandler(1, "onScroll", 10, true));
+  registry_.registerEventHandler(makeHandler(2, "onLayout", 10, true));
+  EXPECT_FALSE(dispatch("onScroll", 11, 1).ranWorklets);
+  // only queued until the next frame
+  EXPECT_FALSE(dispatch("onScroll", 10, 1).ranWorklets);
+  EXPECT_TRUE(runs_.empty());
+  // flushes the queued scroll first
+  EXPECT_TRUE(dispatch("onLayout", 10, 2).ranWorklets);
+  EXPECT_EQ(runs_.size(), 2);
+}
+
+TEST_F(EventHandlerRegistryTest, RunsDiscreteEventsRightAway) {
+  // opting in doesn't delay events which aren't continuous
+  registry_.registerEventHandler(
+      makeHandler(1, "onGestureHandlerStateChange", 10, true));
+  dispatch("onGestureHandlerStateChange", 10, 1);
+  EXPECT_EQ(
+      runs_,
+      (std::vector<HandlerRun>{{1, "onGestureHandlerStateChange", 1, -1}}));
+  EXPECT_FALSE(registry_.hasCoalescedEvents());
+}
+
+TEST_F(EventHandlerRegistryTest, DoesntReorderStateChangesAndMoves) {
+  registry_.registerEventHandler(
+      makeHandler(1, "onGestureHandlerEvent", 10, true));
+  registry_.registerEventHandler(
+      makeHandler(2, "onGestureHandlerStateChange", 10, true));
+  // a move of another view isn't flushed by the state change
+  registry_.registerEventHandler(
+      makeHandler(3, "onGestureHandlerEvent", 11, true));
+
+  dispatch("onGestureHandlerEvent", 10, 1);
+  dispatch("onGestureHandlerEvent", 11, 10);
+  dispatch("onGestureHandlerEvent", 10, 2);
+  dispatch("onGestureHandlerStateChange", 10, 3); // e.g. ACTIVE -> END
+  dispatch("onGestureHandlerEvent", 10, 4);
+  EXPECT_EQ(
+      runs_,
+      (std::vector<HandlerRun>{
+          {1, "onGestureHandlerEvent", 2, 1},
+          {2, "onGestureHandlerStateChange", 3, -1}}));
+
+  registry_.flushCoalescedEvents(rt_);
+  EXPECT_EQ(
+      runs_,
+      (std::vector<HandlerRun>{
+          {1, "onGestureHandlerEvent", 2, 1},
+          {2, "onGestureHandlerStateChange", 3, -1},
+          {3, "onGestureHandlerEvent", 10, 0},
+          {1, "onGestureHandlerEvent", 4, 0}}));
+}
+
+} // namespace
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <hermes/hermes.h>
+
+#include <string>
+
+#include "EventPayload.h"
+
+using namespace reanimated;
+
+namespace {
+
+// The payload of `onScroll` on Android.
+folly::dynamic makeScrollPayload() {
+  return folly::dynamic::object(
+      "contentInset",
+      folly::dynamic::object("top", 0)("bottom", 0)("left", 0)("right", 0))(
+      "contentOffset", folly::dynamic::object("x", 0)("y", 1234.5))(
+      "contentSize", folly::dynamic::object("width", 390)("height", 12000))(
+      "layoutMeasurement",
+      folly::dynamic::object("width", 390)("height", 844))(
+      "velocity", folly::dynamic::object("x", 0)("y", -2.25))(
+      "responderIgnoreScroll", true)("target", 42);
+}
+
+void BM_EventPayloadFromDynamic(benchmark::State &state) {
+  auto rt = facebook::hermes::makeHermesRuntime();
+  const auto payload = makeScrollPayload();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(eventPayloadFromDynamic(*rt, payload));
+  }
+}
+BENCHMARK(BM_EventPayloadFromDynamic);
+
+// What NativeProxy::handleEvent does for maps it can't read directly.
+void BM_EventPayloadFromJson(benchmark::State &state) {
+  auto rt = facebook::hermes::makeHermesRuntime();
+  const auto payload = makeScrollPayload();
+  for (auto _ : state) {
+    std::string json = folly::toJson(payload);
+    benchmark::DoNotOptimize(jsi::Value::createFromJsonUtf8(
+        *rt, reinterpret_cast<const uint8_t *>(json.data()), json.size()));
+  }
+}
+BENCHMARK(BM_EventPayloadFromJson);
+
+} // namespace
@@ -0,0 +1,71 @@
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+
+#include <cmath>
+#include <limits>
+
+#include "EventPayload.h"
+
+using namespace reanimated;
+
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+// Like the payload of a scroll event from a library which doesn't sanitize
+// its numbers, see issue #1776.
+folly::dynamic makeNonFinitePayload() {
+  return folly::dynamic::object(
+      "contentOffset",
+      folly::dynamic::object("x", std::nan(""))("y", kInfinity))(
+      "velocity", -kInfinity)("target", 42);
+}
+
+TEST(EventPayloadTest, KeepsNonFiniteNumbers) {
+  auto rt = facebook::hermes::makeHermesRuntime();
+  const auto value = eventPayloadFromDynamic(*rt, makeNonFinitePayload());
+
+  const auto object = value.asObject(*rt);
+  const auto contentOffset =
+      object.getProperty(*rt, "contentOffset").asObject(*rt);
+  EXPECT_TRUE(std::isnan(contentOffset.getProperty(*rt, "x").asNumber()));
+  EXPECT_EQ(contentOffset.getProperty(*rt, "y").asNumber(), kInfinity);
+  EXPECT_EQ(object.getProperty(*rt, "velocity").asNumber(), -kInfinity);
+  EXPECT_EQ(object.getProperty(*rt, "target").asNumber(), 42);
+}
+
+TEST(EventPayloadTest, JsonRejectsNonFiniteNumbers) {
+  // why native maps aren't converted through JSON
+  EXPECT_THROW(folly::toJson(makeNonFinitePayload()), std::exception);
+}
+
+TEST(EventPayloadTest, ConvertsNestedValues) {
+  auto rt = facebook::hermes::makeHermesRuntime();
+  const folly::dynamic payload = folly::dynamic::object(
+      "touches", folly::dynamic::array(folly::dynamic::object("x", 1.5)))(
+      "state", "ACTIVE")("pointerInside", true);
+  const auto value = eventPayloadFromDynamic(*rt, payload);
+
+  const auto object = value.asObject(*rt);
+  const auto touches =
+      object.getProperty(*rt, "touches").asObject(*rt).asArray(*rt);
+  ASSERT_EQ(touches.size(*rt), 1);
+  EXPECT_EQ(
+      touches.getValueAtIndex(*rt, 0)
+          .asObject(*rt)
+          .getProperty(*rt, "x")
+          .asNumber(),
+      1.5);
+  EXPECT_EQ(
+      object.getProperty(*rt, "state").asString(*rt).utf8(*rt), "ACTIVE");
+  EXPECT_TRUE(object.getProperty(*rt, "pointerInside").getBool());
+}
+
+TEST(EventPayloadTest, ConvertsNullToNull) {
+  auto rt = facebook::hermes::makeHermesRuntime();
+  EXPECT_TRUE(eventPayloadFromDynamic(*rt, nullptr).isNull());
+}
+
+} // namespace
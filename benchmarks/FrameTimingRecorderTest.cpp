@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+#include "FrameTimingRecorder.h"
+
+using namespace reanimated;
+
+namespace {
+
+size_t countOccurrences(const std::string &text, const std::string &pattern) {
+  size_t count = 0;
+  for (auto pos = text.find(pattern); pos != std::string::npos;
+       pos = text.find(pattern, pos + 1)) {
+    ++count;
+  }
+  return count;
+}
+
+TEST(FrameTimingRecorderTest, SpansOfEachThreadGoToTheirOwnTrack) {
+  FrameTimingRecorder recorder;
+  recorder.setCurrentThreadName("Reanimated UI");
+  recorder.record(FramePhase::Frame, 1000, 2000, 1);
+
+  std::thread backgroundThread([&recorder] {
+    recorder.setCurrentThreadName("Reanimated layout commit");
+    recorder.record(FramePhase::Commit, 1500, 2500, 3);
+  });
+  backgroundThread.join();
+  std::thread unnamedThread(
+      [&recorder] { recorder.record(FramePhase::UIJobs, 1600, 1700, 2); });
+  unnamedThread.join();
+
+  const auto json = recorder.toTraceJSON();
+  EXPECT_EQ(countOccurrences(json, "\"ph\":\"X\""), 3u);
+  EXPECT_EQ(countOccurrences(json, "\"thread_name\""), 3u);
+  EXPECT_NE(json.find("\"name\":\"Reanimated UI\""), std::string::npos);
+  EXPECT_NE(
+      json.find("\"name\":\"Reanimated layout commit\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"Thread "), std::string::npos);
+
+  // the commit span is not on the UI track
+  const auto frameTid = json.substr(json.find("\"tid\":", json.find("Frame")));
+  const auto commitTid =
+      json.substr(json.find("\"tid\":", json.find("\"Commit\"")));
+  EXPECT_NE(
+      frameTid.substr(0, frameTid.find(',')),
+      commitTid.substr(0, commitTid.find(',')));
+}
+
+TEST(FrameTimingRecorderTest, EmptyTraceIsValid) {
+  FrameTimingRecorder recorder;
+  EXPECT_EQ(
+      recorder.toTraceJSON(), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}");
+}
+
+} // namespace
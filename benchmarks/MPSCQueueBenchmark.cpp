@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <thread>
+#include <vector>
+
+#include "MPSCQueue.h"
+#include "ThreadSafeQueue.h"
+#include "UniqueFunction.h"
+
+using namespace reanimated;
+
+namespace {
+
+using Job = UniqueFunction<void()>;
+
+constexpr int kJobsPerProducer = 10000;
+
+// Drains the way UIScheduler did before it used MPSCQueue.
+size_t drain(ThreadSafeQueue<Job> &queue) {
+  size_t count = 0;
+  while (queue.getSize() > 0) {
+    queue.pop()();
+    ++count;
+  }
+  return count;
+}
+
+size_t drain(MPSCQueue<Job> &queue) {
+  return queue.drain([](Job &&job) { job(); });
+}
+
+// Every producer pushes `kJobsPerProducer` jobs while the consumer keeps
+// draining, like the JS thread scheduling worklets on the UI thread.
+template <typename Queue>
+void BM_PushAndDrain(benchmark::State &state) {
+  const auto producers = static_cast<int>(state.range(0));
+  const size_t totalJobs = static_cast<size_t>(producers) * kJobsPerProducer;
+  size_t jobsRun = 0;
+
+  for (auto _ : state) {
+    Queue queue;
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    for (int i = 0; i < producers; ++i) {
+      threads.emplace_back([&queue, &jobsRun] {
+        for (int j = 0; j < kJobsPerProducer; ++j) {
+          queue.push(Job([&jobsRun] { ++jobsRun; }));
+        }
+      });
+    }
+    size_t drained = 0;
+    while (drained < totalJobs) {
+      drained += drain(queue);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  benchmark::DoNotOptimize(jobsRun);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * totalJobs));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_PushAndDrain, ThreadSafeQueue<Job>)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PushAndDrain, MPSCQueue<Job>)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "MapperRegistry.h"
+
+using namespace reanimated;
+
+namespace {
+
+constexpr SharedValueId kChains = 100;
+constexpr SharedValueId kChainLength = 10;
+
+// Shared value `chain * kChainLength + i` is the input of the i-th mapper of
+// the chain, which writes the input of the next one.
+jsi::Function makeMapper(
+    jsi::Runtime &rt,
+    MapperRegistry &registry,
+    std::vector<SharedValueId> outputs) {
+  return jsi::Function::createFromHostFunction(
+      rt,
+      jsi::PropNameID::forAscii(rt, "mapper"),
+      0,
+      [&registry, outputs](
+          jsi::Runtime &, const jsi::Value &, const jsi::Value *, size_t) {
+        for (auto output : outputs) {
+          registry.markInputDirty(output);
+        }
+        return jsi::Value::undefined();
+      });
+}
+
+// With `reversed` every chain is started from its end, so that mappers are
+// inserted between the ranks of the others.
+void startMappers(jsi::Runtime &rt, MapperRegistry &registry, bool reversed) {
+  for (SharedValueId chain = 0; chain < kChains; ++chain) {
+    for (SharedValueId i = 0; i < kChainLength; ++i) {
+      const auto index = reversed ? kChainLength - 1 - i : i;
+      const auto input = chain * kChainLength + index;
+      std::vector<SharedValueId> outputs;
+      if (index + 1 < kChainLength) {
+        outputs.push_back(input + 1);
+      }
+      registry.startMapper(
+          input, makeMapper(rt, registry, outputs), {input}, outputs);
+    }
+  }
+}
+
+// 1000 mappers, the first mapper of `state.range(0)` chains gets dirty.
+void BM_RunDirtyMappers(benchmark::State &state) {
+  jsi::Runtime rt;
+  MapperRegistry registry;
+  startMappers(rt, registry, false);
+  registry.run(rt);
+  const auto dirtyChains = static_cast<SharedValueId>(state.range(0));
+  for (auto _ : state) {
+    for (SharedValueId chain = 0; chain < dirtyChains; ++chain) {
+      registry.markInputDirty(chain * kChains / dirtyChains * kChainLength);
+    }
+    benchmark::DoNotOptimize(registry.run(rt));
+  }
+  state.SetItemsProcessed(state.iterations() * dirtyChains * kChainLength);
+  registry.clear();
+}
+BENCHMARK(BM_RunDirtyMappers)->Arg(1)->Arg(4)->Arg(16)->Arg(kChains);
+
+void BM_StartMappers(benchmark::State &state) {
+  jsi::Runtime rt;
+  for (auto _ : state) {
+    MapperRegistry registry;
+    startMappers(rt, registry, state.range(0) != 0);
+    benchmark::DoNotOptimize(registry.run(rt));
+  }
+  state.SetItemsProcessed(state.iterations() * kChains * kChainLength);
+}
+BENCHMARK(BM_StartMappers)->ArgName("reversed")->Arg(0)->Arg(1);
+
+} // namespace
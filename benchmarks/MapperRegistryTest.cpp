@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "MapperRegistry.h"
+
+using namespace reanimated;
+
+namespace {
+
+class MapperRegistryTest : public testing::Test {
+ protected:
+  MapperRegistryTest() {
+    registry_.setRequestRunFunction(
+        [this](bool nextFrame) { requestedRuns_.push_back(nextFrame); });
+  }
+
+  // Like the mappers in JS, writes its outputs when it runs. `onRun` runs
+  // before that.
+  void startMapper(
+      MapperId id,
+      std::vector<SharedValueId> inputs,
+      std::vector<SharedValueId> outputs,
+      std::function<void()> onRun = nullptr) {
+    auto worklet = jsi::Function::createFromHostFunction(
+        rt_,
+        jsi::PropNameID::forAscii(rt_, "mapper"),
+        0,
+        [this, id, outputs, onRun = std::move(onRun)](
+            jsi::Runtime &, const jsi::Value &, const jsi::Value *, size_t) {
+          runs_.push_back(id);
+          if (onRun) {
+            onRun();
+          }
+          for (auto output : outputs) {
+            registry_.markInputDirty(output);
+          }
+          return jsi::Value::undefined();
+        });
+    registry_.startMapper(
+        id, std::move(worklet), std::move(inputs), std::move(outputs));
+  }
+
+  std::vector<MapperId> run() {
+    runs_.clear();
+    requestedRuns_.clear();
+    registry_.run(rt_);
+    return runs_;
+  }
+
+  jsi::Runtime rt_;
+  MapperRegistry registry_;
+  std::vector<MapperId> runs_;
+  std::vector<bool> requestedRuns_;
+};
+
+TEST_F(MapperRegistryTest, RunsMappersStartedOutOfOrderInTopologicalOrder) {
+  // 1 -> 2 -> 3, started from the end of the chain
+  startMapper(3, {20}, {});
+  startMapper(2, {10}, {20});
+  startMapper(1, {}, {10});
+  EXPECT_EQ(requestedRuns_, std::vector<bool>{false});
+  EXPECT_EQ(run(), (std::vector<MapperId>{1, 2, 3}));
+  EXPECT_TRUE(requestedRuns_.empty());
+
+  registry_.markInputDirty(10);
+  EXPECT_EQ(run(), (std::vector<MapperId>{2, 3}));
+  registry_.markInputDirty(20);
+  EXPECT_EQ(run(), (std::vector<MapperId>{3}));
+}
+
+TEST_F(MapperRegistryTest, SortsWhenThereIsNoRankLeftInBetween) {
+  // Every mapper is inserted before the previous one, halving the gap. The gap
+  // of 1024 runs out after 10 mappers and the rest of them are sorted.
+  constexpr MapperId kMappers = 20;
+  startMapper(kMappers, {kMappers}, {});
+  for (MapperId id = kMappers - 1; id >= 1; --id) {
+    startMapper(id, {id}, {id + 1});
+  }
+  std::vector<MapperId> order;
+  for (MapperId id = 1; id <= kMappers; ++id) {
+    order.push_back(id);
+  }
+  EXPECT_EQ(run(), order);
+
+  // a mapper added after sorting still goes in between
+  startMapper(kMappers + 1, {3}, {kMappers});
+  registry_.markInputDirty(1);
+  const auto runs = run();
+  EXPECT_EQ(runs.size(), kMappers + 1);
+  EXPECT_EQ(runs.back(), kMappers);
+}
+
+TEST_F(MapperRegistryTest, DefersMappersDirtiedByLaterOnesToTheNextRun) {
+  startMapper(1, {10}, {});
+  // writes the input of mapper 1 without declaring it as an output
+  startMapper(2, {20}, {}, [this] { registry_.markInputDirty(10); });
+  EXPECT_EQ(run(), (std::vector<MapperId>{1, 2}));
+  // mapper 1 would see a stale value, so it runs on the next frame
+  EXPECT_EQ(requestedRuns_, std::vector<bool>{true});
+  EXPECT_EQ(run(), (std::vector<MapperId>{1}));
+  EXPECT_TRUE(requestedRuns_.empty());
+}
+
+TEST_F(MapperRegistryTest, StopsMappersFromARunningMapper) {
+  startMapper(1, {10}, {20}, [this] {
+    registry_.stopMapper(1);
+    registry_.stopMapper(3);
+  });
+  startMapper(2, {20}, {});
+  startMapper(3, {20}, {});
+  EXPECT_EQ(run(), (std::vector<MapperId>{1, 2}));
+
+  registry_.markInputDirty(10);
+  registry_.markInputDirty(20);
+  EXPECT_EQ(run(), (std::vector<MapperId>{2}));
+  // stopped mappers can be started again
+  startMapper(1, {10}, {20});
+  EXPECT_EQ(run(), (std::vector<MapperId>{1, 2}));
+}
+
+TEST_F(MapperRegistryTest, RequestsRunsAfterClear) {
+  startMapper(1, {10}, {});
+  EXPECT_EQ(requestedRuns_, std::vector<bool>{false});
+  // e.g. on reload, before the requested run happened
+  registry_.clear();
+  requestedRuns_.clear();
+  startMapper(1, {10}, {});
+  EXPECT_EQ(requestedRuns_, std::vector<bool>{false});
+  EXPECT_EQ(run(), (std::vector<MapperId>{1}));
+}
+
+} // namespace
@@ -0,0 +1,250 @@
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "NativeReanimatedModuleSpec.h"
+
+using namespace reanimated;
+
+namespace {
+
+// Records which method the method table called, and with which arguments.
+class RecordingModule : public NativeReanimatedModuleSpec {
+ public:
+  RecordingModule() : NativeReanimatedModuleSpec(nullptr) {}
+
+  struct Call {
+    std::string method;
+    std::vector<double> args;
+  };
+
+  struct Entry {
+    std::string name;
+    size_t argCount;
+    Call call;
+  };
+
+  // Calls every method in the table with as many arguments as the table
+  // declares, numbered from 0.
+  std::vector<Entry> callAll(jsi::Runtime &rt) {
+    std::vector<Entry> result;
+    for (const auto &[name, metadata] : methodMap_) {
+      std::vector<jsi::Value> args;
+      for (size_t i = 0; i < metadata.argCount; ++i) {
+        args.emplace_back(static_cast<double>(i));
+      }
+      lastCall_ = {};
+      metadata.invoker(rt, *this, args.data(), args.size());
+      result.push_back({name, metadata.argCount, lastCall_});
+    }
+    return result;
+  }
+
+  void installCoreFunctions(
+      jsi::Runtime &,
+      const jsi::Value &callGuard,
+      const jsi::Value &valueUnpacker) override {
+    record("installCoreFunctions", {&callGuard, &valueUnpacker});
+  }
+
+  jsi::Value makeShareableClone(
+      jsi::Runtime &,
+      const jsi::Value &value,
+      const jsi::Value &shouldRetainRemote) override {
+    return record("makeShareableClone", {&value, &shouldRetainRemote});
+  }
+
+  jsi::Value makeSynchronizedDataHolder(
+      jsi::Runtime &,
+      const jsi::Value &initialShareable) override {
+    return record("makeSynchronizedDataHolder", {&initialShareable});
+  }
+
+  jsi::Value getDataSynchronously(
+      jsi::Runtime &,
+      const jsi::Value &synchronizedDataHolderRef) override {
+    return record("getDataSynchronously", {&synchronizedDataHolderRef});
+  }
+
+  void scheduleOnUI(jsi::Runtime &, const jsi::Value &worklet) override {
+    record("scheduleOnUI", {&worklet});
+  }
+
+  void startBackgroundRuntimes(
+      jsi::Runtime &,
+      const jsi::Value &count,
+      const jsi::Value &initializer) override {
+    record("startBackgroundRuntimes", {&count, &initializer});
+  }
+
+  void scheduleOnBackground(
+      jsi::Runtime &,
+      const jsi::Value &worklet,
+      const jsi::Value &onResult) override {
+    record("scheduleOnBackground", {&worklet, &onResult});
+  }
+
+  jsi::Value registerEventHandler(
+      jsi::Runtime &,
+      const jsi::Value &worklet,
+      const jsi::Value &eventName,
+      const jsi::Value &emitterReactTag,
+      const jsi::Value &shouldConsumeEvent,
+      const jsi::Value &shouldCoalesceEvents) override {
+    return record(
+        "registerEventHandler",
+        {&worklet,
+         &eventName,
+         &emitterReactTag,
+         &shouldConsumeEvent,
+         &shouldCoalesceEvents});
+  }
+
+  void unregisterEventHandler(
+      jsi::Runtime &,
+      const jsi::Value &registrationId) override {
+    record("unregisterEventHandler", {&registrationId});
+  }
+
+  jsi::Value registerFrameCallback(jsi::Runtime &, const jsi::Value &worklet)
+      override {
+    return record("registerFrameCallback", {&worklet});
+  }
+
+  void unregisterFrameCallback(jsi::Runtime &, const jsi::Value &callbackId)
+      override {
+    record("unregisterFrameCallback", {&callbackId});
+  }
+
+  void setFrameCallbackActive(
+      jsi::Runtime &,
+      const jsi::Value &callbackId,
+      const jsi::Value &isActive) override {
+    record("setFrameCallbackActive", {&callbackId, &isActive});
+  }
+
+  jsi::Value getFrameTimingTrace(jsi::Runtime &) override {
+    return record("getFrameTimingTrace", {});
+  }
+
+  jsi::Value getPropsUpdateStats(jsi::Runtime &) override {
+    return record("getPropsUpdateStats", {});
+  }
+
+  void setPropsUpdateEpsilon(jsi::Runtime &, const jsi::Value &epsilon)
+      override {
+    record("setPropsUpdateEpsilon", {&epsilon});
+  }
+
+  jsi::Value getViewProp(
+      jsi::Runtime &,
+      const jsi::Value &viewTag,
+      const jsi::Value &propName,
+      const jsi::Value &callback) override {
+    return record("getViewProp", {&viewTag, &propName, &callback});
+  }
+
+  jsi::Value registerSensor(
+      jsi::Runtime &,
+      const jsi::Value &sensorType,
+      const jsi::Value &interval,
+      const jsi::Value &iosReferenceFrame,
+      const jsi::Value &sensorDataContainer) override {
+    return record(
+        "registerSensor",
+        {&sensorType, &interval, &iosReferenceFrame, &sensorDataContainer});
+  }
+
+  void unregisterSensor(jsi::Runtime &, const jsi::Value &sensorId) override {
+    record("unregisterSensor", {&sensorId});
+  }
+
+  jsi::Value subscribeForKeyboardEvents(
+      jsi::Runtime &,
+      const jsi::Value &keyboardEventContainer,
+      const jsi::Value &isStatusBarTranslucent) override {
+    return record(
+        "subscribeForKeyboardEvents",
+        {&keyboardEventContainer, &isStatusBarTranslucent});
+  }
+
+  void unsubscribeFromKeyboardEvents(
+      jsi::Runtime &,
+      const jsi::Value &listenerId) override {
+    record("unsubscribeFromKeyboardEvents", {&listenerId});
+  }
+
+  jsi::Value enableLayoutAnimations(jsi::Runtime &, const jsi::Value &config)
+      override {
+    return record("enableLayoutAnimations", {&config});
+  }
+
+  jsi::Value configureProps(
+      jsi::Runtime &,
+      const jsi::Value &uiProps,
+      const jsi::Value &nativeProps) override {
+    return record("configureProps", {&uiProps, &nativeProps});
+  }
+
+  jsi::Value configureLayoutAnimation(
+      jsi::Runtime &,
+      const jsi::Value &viewTag,
+      const jsi::Value &type,
+      const jsi::Value &sharedTransitionTag,
+      const jsi::Value &config) override {
+    return record(
+        "configureLayoutAnimation",
+        {&viewTag, &type, &sharedTransitionTag, &config});
+  }
+
+ private:
+  jsi::Value record(
+      const char *method,
+      std::initializer_list<const jsi::Value *> args) {
+    lastCall_.method = method;
+    for (const auto *arg : args) {
+      lastCall_.args.push_back(arg->asNumber());
+    }
+    return jsi::Value::undefined();
+  }
+
+  Call lastCall_;
+};
+
+// Every entry of the table has to call the method of its name with its
+// arguments in order, and never read more arguments than the table declares.
+// Declaring more is harmless, `enableLayoutAnimations` declares 2 and takes 1.
+TEST(NativeReanimatedModuleSpecTest, MethodTableMatchesTheMethods) {
+  jsi::Runtime rt;
+  RecordingModule module;
+  const auto entries = module.callAll(rt);
+  EXPECT_EQ(entries.size(), 23);
+  for (const auto &[name, argCount, call] : entries) {
+    EXPECT_EQ(call.method, name);
+    EXPECT_LE(call.args.size(), argCount) << name;
+    for (size_t i = 0; i < call.args.size(); ++i) {
+      EXPECT_EQ(call.args[i], i) << name << " argument " << i;
+    }
+  }
+}
+
+TEST(NativeReanimatedModuleSpecTest, DeclaresTheArgumentsOfChangedMethods) {
+  jsi::Runtime rt;
+  RecordingModule module;
+  for (const auto &[name, argCount, call] : module.callAll(rt)) {
+    if (name == "registerEventHandler") {
+      EXPECT_EQ(argCount, 5);
+      EXPECT_EQ(call.args.size(), 5);
+    } else if (
+        name == "registerSensor" || name == "configureLayoutAnimation") {
+      EXPECT_EQ(argCount, 4) << name;
+      EXPECT_EQ(call.args.size(), 4) << name;
+    }
+  }
+}
+
+} // namespace
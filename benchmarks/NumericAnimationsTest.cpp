@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "NumericAnimations.h"
+
+using namespace reanimated;
+
+namespace {
+
+// The expected values come from stepping the frame functions of
+// src/reanimated2/animation (timing.ts, spring.ts, decay.ts) and Bezier.ts in
+// node, with the same configs and frames.
+
+constexpr double kTolerance = 1e-9;
+
+struct ExpectedFrame {
+  size_t index;
+  double current;
+  double velocity;
+};
+
+// Frames are 16ms apart, except for the third one which comes 100ms after the
+// second one, so that it's stepped by kMaxDeltaTime (64ms) only.
+double frameTime(size_t index) {
+  return 1016 + 16 * index + (index >= 2 ? 84 : 0);
+}
+
+// Steps the animation until it finishes and checks the given frames and the
+// number of frames it took.
+template <typename Animation>
+void expectFrames(
+    Animation animation,
+    size_t frameCount,
+    const std::vector<ExpectedFrame> &expectedFrames) {
+  std::vector<Animation> frames;
+  bool finished = false;
+  for (size_t i = 0; !finished && i < frameCount + 1; ++i) {
+    finished = animation.step(frameTime(i));
+    frames.push_back(animation);
+  }
+  EXPECT_TRUE(finished);
+  ASSERT_EQ(frames.size(), frameCount);
+  for (const auto &expected : expectedFrames) {
+    SCOPED_TRACE(expected.index);
+    EXPECT_NEAR(frames[expected.index].current, expected.current, kTolerance);
+    EXPECT_NEAR(
+        frames[expected.index].velocity, expected.velocity, kTolerance);
+  }
+}
+
+// `withSpring` with a physics based config, started at 0 at 1000ms.
+SpringAnimation
+makeSpring(double damping, double mass, double stiffness, double toValue) {
+  const double zeta = damping / (2 * std::sqrt(stiffness * mass));
+  const double omega0 = std::sqrt(stiffness / mass);
+  return SpringAnimation{
+      0,
+      0,
+      1000,
+      1000,
+      0,
+      toValue,
+      zeta,
+      omega0,
+      // NaN for over-damped springs, like in JS, it isn't used by them
+      omega0 * std::sqrt(1 - zeta * zeta),
+      0,
+      0.01,
+      2,
+      false,
+      false,
+      false};
+}
+
+// `withDecay` with the default deceleration, started at 1000ms.
+DecayAnimation makeDecay(
+    double value,
+    double velocity,
+    std::optional<std::array<double, 2>> clamp,
+    bool rubberBandEffect) {
+  return DecayAnimation{
+      value,
+      velocity,
+      1000,
+      1000,
+      velocity,
+      0.998,
+      1,
+      0.6,
+      clamp,
+      rubberBandEffect,
+      false};
+}
+
+TEST(NumericAnimationsTest, TimingWithBezierEasing) {
+  TimingAnimation animation{
+      10, 1000, 10, 110, 300, BezierEasing(0.25, 0.1, 0.25, 1)};
+  const std::vector<std::pair<double, double>> expectedFrames = {
+      {1016, 13.613656925709504},
+      {1100, 67.586231757762278},
+      {1150, 90.240338758485692},
+      {1233, 106.90768949823878},
+      {1299.5, 109.99985170128740}};
+  for (const auto &[now, current] : expectedFrames) {
+    EXPECT_FALSE(animation.step(now));
+    EXPECT_NEAR(animation.current, current, kTolerance);
+  }
+  EXPECT_TRUE(animation.step(1300));
+  EXPECT_EQ(animation.current, 110);
+  EXPECT_EQ(animation.startTime, 0);
+}
+
+TEST(NumericAnimationsTest, UnderDampedSpring) {
+  expectFrames(
+      makeSpring(10, 1, 100, 100),
+      80,
+      {{0, 1.2118183855440634, 147.22643337529422},
+       {1, 4.5765140015337096, 269.20901009013312},
+       {2, 31.906760676794761, 527.92603994404192},
+       {3, 40.504393864916317, 544.05511480827931},
+       {4, 49.235301969933062, 544.95611971442690},
+       {78, 100.02555003040429, -1.5262393513861676},
+       {79, 100, 0}});
+}
+
+TEST(NumericAnimationsTest, OverDampedSpring) {
+  expectFrames(
+      makeSpring(40, 1, 100, 100),
+      71,
+      {{0, 1.1513204799194909, 136.34300623459382},
+       {1, 4.1483271062728022, 232.36769186358109},
+       {2, 24.952994348878036, 367.57717053610753},
+       {3, 30.828683539915630, 365.43336997780420},
+       {4, 36.607495496671731, 355.88774458008845},
+       {69, 99.989270988645231, 0.098828748125961305},
+       {70, 100, 0}});
+}
+
+TEST(NumericAnimationsTest, DecayStopsBelowVelocityEpsilon) {
+  expectFrames(
+      makeDecay(0, 500, std::nullopt, false),
+      58,
+      {{0, 7.9744409163442631, 498.40255727151646},
+       {1, 15.898008379521990, 495.22296644860796},
+       {2, 46.766497770981921, 482.32014674156142},
+       {3, 54.258540903284249, 468.25269576889536},
+       {4, 61.508831437001540, 453.14315835733072},
+       {56, 162.79961268803740, 1.0010086067241912},
+       {57, 162.81269415928833, 0.81759195318351008}});
+}
+
+TEST(NumericAnimationsTest, DecayStopsAtClamp) {
+  expectFrames(
+      makeDecay(0, -1500, std::array<double, 2>{-200, 200}, false),
+      6,
+      {{0, -23.923322749032788, -1495.2076718145493},
+       {1, -47.694025138565969, -1485.6688993458238},
+       {2, -140.29949331294574, -1446.9604402246841},
+       {3, -162.77562270985271, -1404.7580873066861},
+       {4, -184.52649431100460, -1359.4294750719921},
+       {5, -200, -1311.3604478030543}});
+}
+
+TEST(NumericAnimationsTest, DecayWithRubberBandSpringsBackToClamp) {
+  expectFrames(
+      makeDecay(50, 2000, std::array<double, 2>{0, 100}, true),
+      38,
+      {{0, 81.897763665377056, 1993.6102290860658},
+       {1, 113.59203351808796, 1980.8918657944319},
+       {2, 236.54405699683309, 1921.1253668553929},
+       {3, 265.07472876697398, 1783.1669856338067},
+       {4, 291.10005789654167, 1626.5830705979795},
+       {36, 99.974185309669906, -468.35320568529880},
+       {37, 100, -468.35320568529880}});
+}
+
+} // namespace
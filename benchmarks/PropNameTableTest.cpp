@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PropNameTable.h"
+
+using namespace reanimated;
+
+namespace {
+
+TEST(PropNameTableTest, InternsNames) {
+  PropNameTable table;
+  const auto opacity = table.intern("opacity");
+  const auto width = table.intern("width");
+  EXPECT_NE(opacity, width);
+  EXPECT_EQ(table.intern("opacity"), opacity);
+  EXPECT_EQ(table.getName(opacity), "opacity");
+  EXPECT_EQ(table.getName(width), "width");
+}
+
+TEST(PropNameTableTest, NamesDontMoveWhenTheTableGrows) {
+  PropNameTable table;
+  const auto &first = table.getName(table.intern("prop0"));
+  for (int i = 1; i < 1000; ++i) {
+    table.intern("prop" + std::to_string(i));
+  }
+  EXPECT_EQ(&table.getName(table.intern("prop0")), &first);
+  EXPECT_EQ(table.getName(table.intern("prop999")), "prop999");
+}
+
+TEST(PropNameTableTest, NamesCanBeReadWhileOthersAreInterned) {
+  PropNameTable table;
+  constexpr int kNames = 2000;
+  std::vector<std::atomic<int>> ids(kNames);
+  for (auto &id : ids) {
+    id = -1;
+  }
+
+  std::thread writer([&] {
+    for (int i = 0; i < kNames; ++i) {
+      ids[i].store(
+          table.intern("prop" + std::to_string(i)), std::memory_order_release);
+    }
+  });
+  // like React's commit thread reading names of ids published by the UI
+  // thread
+  for (int i = 0; i < kNames; ++i) {
+    int id;
+    while ((id = ids[i].load(std::memory_order_acquire)) < 0) {
+      std::this_thread::yield();
+    }
+    EXPECT_EQ(
+        table.getName(static_cast<PropNameId>(id)),
+        "prop" + std::to_string(i));
+  }
+  writer.join();
+}
+
+TEST(PropNameTableTest, ConfiguresKinds) {
+  PropNameTable table;
+  const auto version = table.getVersion();
+  table.configure("opacity", kUIProp);
+  table.configure("opacity", kUIProp);
+  EXPECT_EQ(table.getVersion(), version + 1);
+  EXPECT_EQ(table.getKinds(table.intern("opacity")), kUIProp);
+  EXPECT_EQ(table.getKinds(table.intern("unknown")), kUnknownProp);
+}
+
+TEST(PropsShapeCacheTest, KeepsTheKeysOfTheLastUpdate) {
+  jsi::Runtime rt;
+  PropNameTable table;
+  table.configure("width", kNativeProp);
+  PropsShapeCache cache;
+
+  jsi::Object props(rt);
+  props.setProperty(rt, "opacity", 0.5);
+  props.setProperty(rt, "width", 100);
+  const auto &shape = cache.getShape(rt, table, 1, props);
+  EXPECT_EQ(shape.keys, (std::vector<std::string>{"opacity", "width"}));
+  EXPECT_EQ(table.getName(shape.ids[1]), "width");
+  EXPECT_EQ(shape.kinds, kNativeProp);
+
+  // configuring a prop invalidates the shapes
+  table.configure("opacity", kUIProp);
+  jsi::Object nextProps(rt);
+  nextProps.setProperty(rt, "opacity", 0.25);
+  nextProps.setProperty(rt, "width", 50);
+  EXPECT_EQ(
+      cache.getShape(rt, table, 1, nextProps).kinds, kUIProp | kNativeProp);
+
+  jsi::Object otherProps(rt);
+  otherProps.setProperty(rt, "height", 10);
+  EXPECT_EQ(
+      cache.getShape(rt, table, 1, otherProps).keys,
+      std::vector<std::string>{"height"});
+}
+
+} // namespace
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <hermes/hermes.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "PropNameTable.h"
+#include "PropsUpdateFilter.h"
+
+using namespace reanimated;
+
+namespace {
+
+// One frame of `views` animated views, each updating a moving transform, a
+// settled opacity and a constant color.
+void BM_FilterFrame(benchmark::State &state) {
+  auto rt = facebook::hermes::makeHermesRuntime();
+  const auto views = static_cast<int>(state.range(0));
+  PropNameTable table;
+  PropsShapeCache shapes;
+  PropsUpdateFilter filter;
+  const auto color = jsi::String::createFromUtf8(*rt, "red");
+
+  double translateX = 0;
+  for (auto _ : state) {
+    translateX += 1;
+    for (int tag = 1; tag <= views; ++tag) {
+      state.PauseTiming();
+      jsi::Object translate(*rt);
+      translate.setProperty(*rt, "translateX", translateX + tag);
+      jsi::Array transform(*rt, 1);
+      transform.setValueAtIndex(*rt, 0, std::move(translate));
+      jsi::Object props(*rt);
+      props.setProperty(*rt, "opacity", 1.0);
+      props.setProperty(*rt, "transform", std::move(transform));
+      props.setProperty(*rt, "backgroundColor", jsi::Value(*rt, color));
+      state.ResumeTiming();
+
+      const auto &shape = shapes.getShape(*rt, table, tag, props);
+      uint8_t kinds;
+      benchmark::DoNotOptimize(filter.filter(*rt, tag, shape, props, kinds));
+    }
+  }
+
+  const auto stats = filter.getStats();
+  state.counters["jsiConversions/frame"] = benchmark::Counter(
+      static_cast<double>(stats.jsiConversions),
+      benchmark::Counter::kAvgIterations);
+  state.counters["sentProps/frame"] = benchmark::Counter(
+      static_cast<double>(stats.sentProps),
+      benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_FilterFrame)->Arg(10)->Arg(100);
+
+} // namespace
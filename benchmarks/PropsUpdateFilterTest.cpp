@@ -0,0 +1,79 @@
+#include <folly/dynamic.h>
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "PropNameTable.h"
+#include "PropsUpdateFilter.h"
+
+using namespace reanimated;
+
+namespace {
+
+constexpr Tag kTag = 1;
+
+class PropsUpdateFilterTest : public ::testing::Test {
+ protected:
+  // Like the props of an animated style on every frame.
+  jsi::Object makeProps(double opacity, double translateX, const char *color) {
+    auto &rt = *rt_;
+    jsi::Object translate(rt);
+    translate.setProperty(rt, "translateX", translateX);
+    jsi::Array transform(rt, 1);
+    transform.setValueAtIndex(rt, 0, std::move(translate));
+
+    jsi::Object props(rt);
+    props.setProperty(rt, "opacity", opacity);
+    props.setProperty(rt, "transform", std::move(transform));
+    props.setProperty(
+        rt, "backgroundColor", jsi::String::createFromUtf8(rt, color));
+    return props;
+  }
+
+  // Returns the number of props converted from JSI.
+  uint64_t filter(const jsi::Object &props, folly::dynamic &result) {
+    const auto conversionsBefore = filter_.getStats().jsiConversions;
+    const auto &shape = shapes_.getShape(*rt_, table_, kTag, props);
+    uint8_t kinds;
+    result = filter_.filter(*rt_, kTag, shape, props, kinds);
+    return filter_.getStats().jsiConversions - conversionsBefore;
+  }
+
+  // destroyed last, the shapes hold strings of the runtime
+  std::unique_ptr<jsi::Runtime> rt_ = facebook::hermes::makeHermesRuntime();
+  PropNameTable table_;
+  PropsShapeCache shapes_;
+  PropsUpdateFilter filter_;
+};
+
+TEST_F(PropsUpdateFilterTest, ConvertsEveryPropOnce) {
+  folly::dynamic result;
+  EXPECT_EQ(filter(makeProps(0.5, 10, "red"), result), 3);
+  EXPECT_EQ(result.size(), 3);
+}
+
+TEST_F(PropsUpdateFilterTest, DoesntConvertUnchangedNumbers) {
+  folly::dynamic result;
+  filter(makeProps(0.5, 10, "red"), result);
+
+  // only the transform and the color are converted, to be compared
+  EXPECT_EQ(filter(makeProps(0.5, 10, "red"), result), 2);
+  EXPECT_TRUE(result.empty());
+  EXPECT_EQ(filter_.getStats().suppressedUpdates, 1);
+}
+
+TEST_F(PropsUpdateFilterTest, ConvertsChangedPropsOnce) {
+  folly::dynamic result;
+  filter(makeProps(0.5, 10, "red"), result);
+
+  EXPECT_EQ(filter(makeProps(0.6, 11, "red"), result), 3);
+  EXPECT_EQ(result.size(), 2);
+  EXPECT_EQ(result["opacity"], 0.6);
+  EXPECT_EQ(result["transform"][0]["translateX"], 11);
+}
+
+} // namespace
@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "ShadowTreeCloner.h"
+#include "ShadowTreeModel.h"
+
+using namespace reanimated;
+using namespace reanimated::model;
+
+namespace {
+
+// ShadowTreeCloner::cloneWithNewProps before it took a batch of updates,
+// called once per updated node.
+ShadowNode::Unshared cloneWithNewPropsPerNode(
+    const PropsParserContext &propsParserContext,
+    const ShadowNode::Shared &oldRootNode,
+    const ShadowNodeFamily &family,
+    RawProps &&rawProps) {
+  auto ancestors = family.getAncestors(*oldRootNode);
+
+  if (ancestors.empty()) {
+    return ShadowNode::Unshared{nullptr};
+  }
+
+  auto &parent = ancestors.back();
+  auto &source = parent.first.get().getChildren().at(parent.second);
+
+  const auto props = source->getComponentDescriptor().cloneProps(
+      propsParserContext, source->getProps(), rawProps);
+
+  auto newChildNode = source->clone({/* .props = */ props});
+
+  for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+    auto &parentNode = it->first.get();
+    auto childIndex = it->second;
+
+    auto children = parentNode.getChildren();
+    const auto &oldChildNode = *children.at(childIndex);
+
+    if (!parentNode.getSealed()) {
+      auto &parentNodeNonConst = const_cast<ShadowNode &>(parentNode);
+      parentNodeNonConst.replaceChild(oldChildNode, newChildNode, childIndex);
+      static_cast<YogaLayoutableShadowNode *>(&parentNodeNonConst)
+          ->updateYogaChildren();
+      return std::const_pointer_cast<ShadowNode>(oldRootNode);
+    }
+
+    children[childIndex] = newChildNode;
+
+    newChildNode = parentNode.clone({
+        ShadowNodeFragment::propsPlaceholder(),
+        std::make_shared<ShadowNode::ListOfShared>(children),
+    });
+  }
+
+  return std::const_pointer_cast<ShadowNode>(newChildNode);
+}
+
+// A spine of `depth` nodes ending in one parent of `siblings` animated views,
+// e.g. the items of a list.
+struct Tree {
+  ShadowNode::Shared root;
+  std::vector<ShadowNodeFamily::Shared> families;
+};
+
+Tree makeTree(int depth, int siblings) {
+  Tree tree;
+  Tag nextTag = 1;
+  ShadowNode::ListOfShared children;
+  for (int i = 0; i < siblings; ++i) {
+    auto family = makeFamily(nextTag++);
+    tree.families.push_back(family);
+    children.push_back(makeNode(family));
+  }
+  tree.root = makeChain(
+      depth, 0, makeNode(nextTag++, std::move(children)), nextTag);
+  tree.root->sealRecursive();
+  return tree;
+}
+
+void BM_PerNode(benchmark::State &state) {
+  const auto tree = makeTree(state.range(0), state.range(1));
+  const ContextContainer contextContainer;
+  const PropsParserContext propsParserContext{kSurfaceId, contextContainer};
+  YogaLayoutableShadowNode::updateYogaChildrenCount = 0;
+  double opacity = 0;
+
+  for (auto _ : state) {
+    // the commit callbacks start from a clone of the root
+    ShadowNode::Shared rootNode = tree.root->clone({});
+    opacity += 0.001;
+    for (const auto &family : tree.families) {
+      auto newRootNode = cloneWithNewPropsPerNode(
+          propsParserContext,
+          rootNode,
+          *family,
+          RawProps({{"opacity", opacity}}));
+      if (newRootNode != nullptr) {
+        rootNode = newRootNode;
+      }
+    }
+    benchmark::DoNotOptimize(rootNode);
+  }
+
+  state.counters["yogaUpdates"] = benchmark::Counter(
+      YogaLayoutableShadowNode::updateYogaChildrenCount,
+      benchmark::Counter::kAvgIterations);
+}
+
+void BM_Batch(benchmark::State &state) {
+  const auto tree = makeTree(state.range(0), state.range(1));
+  const UIManager uiManager{std::make_shared<const ContextContainer>()};
+  YogaLayoutableShadowNode::updateYogaChildrenCount = 0;
+  double opacity = 0;
+
+  for (auto _ : state) {
+    ShadowNode::Shared rootNode = tree.root->clone({});
+    opacity += 0.001;
+    ShadowTreeCloner shadowTreeCloner{uiManager, kSurfaceId};
+    for (const auto &family : tree.families) {
+      shadowTreeCloner.updateProps(*family, RawProps({{"opacity", opacity}}));
+    }
+    auto newRootNode = shadowTreeCloner.cloneWithNewProps(rootNode);
+    benchmark::DoNotOptimize(newRootNode);
+  }
+
+  state.counters["yogaUpdates"] = benchmark::Counter(
+      YogaLayoutableShadowNode::updateYogaChildrenCount,
+      benchmark::Counter::kAvgIterations);
+}
+
+// depth, animated siblings
+void treeShapes(benchmark::internal::Benchmark *benchmark) {
+  benchmark->Args({20, 50})->Args({50, 200})->Args({100, 500});
+  benchmark->Unit(benchmark::kMicrosecond);
+}
+
+} // namespace
+
+BENCHMARK(BM_PerNode)->Apply(treeShapes);
+BENCHMARK(BM_Batch)->Apply(treeShapes);
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "ShadowTreeCloner.h"
+#include "ShadowTreeModel.h"
+
+using namespace reanimated;
+using namespace reanimated::model;
+
+namespace {
+
+class ShadowTreeClonerTest : public ::testing::Test {
+ protected:
+  const UIManager uiManager_{std::make_shared<const ContextContainer>()};
+};
+
+double getOpacity(const ShadowNode &node) {
+  const auto &values = node.getProps()->values;
+  const auto it = values.find("opacity");
+  return it != values.end() ? it->second : -1;
+}
+
+TEST_F(ShadowTreeClonerTest, ClonesSharedAncestorsOnce) {
+  const auto first = makeFamily(1);
+  const auto second = makeFamily(2);
+  const auto untouched = makeNode(3);
+  const auto parent =
+      makeNode(4, {makeNode(first), untouched, makeNode(second)});
+  const auto oldRoot = makeNode(5, {parent});
+  oldRoot->sealRecursive();
+
+  ShadowTreeCloner shadowTreeCloner{uiManager_, kSurfaceId};
+  shadowTreeCloner.updateProps(*first, RawProps({{"opacity", 0.5}}));
+  shadowTreeCloner.updateProps(*second, RawProps({{"opacity", 0.25}}));
+  // applied after the first update of the same node
+  shadowTreeCloner.updateProps(*first, RawProps({{"opacity", 0.75}}));
+  const auto newRoot = shadowTreeCloner.cloneWithNewProps(oldRoot);
+
+  ASSERT_NE(newRoot, oldRoot);
+  const auto &newParent = newRoot->getChildren().at(0);
+  ASSERT_NE(newParent, parent);
+  EXPECT_EQ(getOpacity(*newParent->getChildren().at(0)), 0.75);
+  EXPECT_EQ(newParent->getChildren().at(1), untouched);
+  EXPECT_EQ(getOpacity(*newParent->getChildren().at(2)), 0.25);
+  // the old tree is left as it was
+  EXPECT_EQ(getOpacity(*parent->getChildren().at(0)), -1);
+}
+
+TEST_F(ShadowTreeClonerTest, UpdatesUnsealedNodesInPlace) {
+  const auto family = makeFamily(1);
+  const auto oldRoot = makeNode(2, {makeNode(family), makeNode(3)});
+  oldRoot->sealRecursive();
+  const auto rootClone = oldRoot->clone({});
+  const auto yogaUpdates = YogaLayoutableShadowNode::updateYogaChildrenCount;
+
+  ShadowTreeCloner shadowTreeCloner{uiManager_, kSurfaceId};
+  shadowTreeCloner.updateProps(*family, RawProps({{"opacity", 0.5}}));
+  const auto newRoot = shadowTreeCloner.cloneWithNewProps(rootClone);
+
+  EXPECT_EQ(newRoot, rootClone);
+  EXPECT_EQ(getOpacity(*newRoot->getChildren().at(0)), 0.5);
+  EXPECT_EQ(getOpacity(*oldRoot->getChildren().at(0)), -1);
+  EXPECT_EQ(
+      YogaLayoutableShadowNode::updateYogaChildrenCount, yogaUpdates + 1);
+}
+
+TEST_F(ShadowTreeClonerTest, SkipsNodesRemovedFromTheTree) {
+  const auto removed = makeFamily(1);
+  makeNode(2, {makeNode(removed)});
+  const auto oldRoot = makeNode(3, {makeNode(4)});
+  oldRoot->sealRecursive();
+
+  ShadowTreeCloner shadowTreeCloner{uiManager_, kSurfaceId};
+  shadowTreeCloner.updateProps(*removed, RawProps({{"opacity", 0.5}}));
+  EXPECT_EQ(shadowTreeCloner.cloneWithNewProps(oldRoot), oldRoot);
+}
+
+} // namespace
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <react/renderer/core/ShadowNode.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Helpers for building trees of the Fabric host model in tests and
+// benchmarks.
+
+namespace reanimated::model {
+
+using namespace facebook::react;
+
+constexpr SurfaceId kSurfaceId = 1;
+
+inline ShadowNode::Shared makeNode(
+    ShadowNodeFamily::Shared family,
+    ShadowNode::ListOfShared children = {}) {
+  return std::make_shared<YogaLayoutableShadowNode>(
+      std::move(family),
+      std::make_shared<const Props>(),
+      std::make_shared<const ShadowNode::ListOfShared>(std::move(children)));
+}
+
+inline ShadowNodeFamily::Shared makeFamily(Tag tag) {
+  return std::make_shared<const ShadowNodeFamily>(tag, kSurfaceId);
+}
+
+inline ShadowNode::Shared makeNode(
+    Tag tag,
+    ShadowNode::ListOfShared children = {}) {
+  return makeNode(makeFamily(tag), std::move(children));
+}
+
+// A chain of `depth` nodes ending in `leaf`, with `siblings` static nodes
+// before the chain on every level. Tags are taken from `nextTag`.
+inline ShadowNode::Shared makeChain(
+    int depth,
+    int siblings,
+    ShadowNode::Shared leaf,
+    Tag &nextTag) {
+  auto node = std::move(leaf);
+  for (int level = 0; level < depth; ++level) {
+    ShadowNode::ListOfShared children;
+    for (int i = 0; i < siblings; ++i) {
+      children.push_back(makeNode(nextTag++));
+    }
+    children.push_back(std::move(node));
+    node = makeNode(nextTag++, std::move(children));
+  }
+  return node;
+}
+
+} // namespace reanimated::model
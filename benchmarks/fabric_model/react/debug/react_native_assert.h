@@ -0,0 +1,5 @@
+#pragma once
+
+#include <cassert>
+
+#define react_native_assert(e) assert(e)
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <memory>
+
+namespace facebook::react {
+
+class ContextContainer {
+ public:
+  using Shared = std::shared_ptr<const ContextContainer>;
+};
+
+struct PropsParserContext {
+  const SurfaceId surfaceId;
+  const ContextContainer &contextContainer;
+};
+
+} // namespace facebook::react
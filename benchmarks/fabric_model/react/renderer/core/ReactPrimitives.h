@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::react {
+
+using Tag = int32_t;
+using SurfaceId = int32_t;
+
+} // namespace facebook::react
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/ReactPrimitives.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+class ShadowNode;
+
+struct Props {
+  using Shared = std::shared_ptr<const Props>;
+
+  std::unordered_map<std::string, double> values;
+};
+
+class RawProps {
+ public:
+  RawProps() = default;
+  explicit RawProps(std::unordered_map<std::string, double> values)
+      : values_(std::move(values)) {}
+
+  const std::unordered_map<std::string, double> &getValues() const {
+    return values_;
+  }
+
+ private:
+  std::unordered_map<std::string, double> values_;
+};
+
+class ComponentDescriptor {
+ public:
+  Props::Shared cloneProps(
+      const PropsParserContext &,
+      const Props::Shared &props,
+      const RawProps &rawProps) const {
+    auto newProps = props != nullptr ? std::make_shared<Props>(*props)
+                                     : std::make_shared<Props>();
+    for (const auto &[name, value] : rawProps.getValues()) {
+      newProps->values[name] = value;
+    }
+    return newProps;
+  }
+};
+
+class ShadowNodeFamily {
+ public:
+  using Shared = std::shared_ptr<const ShadowNodeFamily>;
+  using AncestorList = std::vector<
+      std::pair<std::reference_wrapper<const ShadowNode>, int /* index */>>;
+
+  ShadowNodeFamily(Tag tag, SurfaceId surfaceId)
+      : tag_(tag), surfaceId_(surfaceId) {}
+
+  Tag getTag() const {
+    return tag_;
+  }
+
+  SurfaceId getSurfaceId() const {
+    return surfaceId_;
+  }
+
+  void setParent(const Shared &parent) const {
+    parent_ = parent;
+  }
+
+  // Same as in React Native 0.72: collects the families up to the one of
+  // `ancestorShadowNode` and then searches the children on every level.
+  AncestorList getAncestors(const ShadowNode &ancestorShadowNode) const;
+
+ private:
+  const Tag tag_;
+  const SurfaceId surfaceId_;
+  mutable std::weak_ptr<const ShadowNodeFamily> parent_;
+};
+
+struct ShadowNodeFragment;
+
+class ShadowNode {
+ public:
+  using Shared = std::shared_ptr<const ShadowNode>;
+  using Unshared = std::shared_ptr<ShadowNode>;
+  using ListOfShared = std::vector<Shared>;
+  using SharedListOfShared = std::shared_ptr<const ListOfShared>;
+
+  ShadowNode(
+      ShadowNodeFamily::Shared family,
+      Props::Shared props,
+      SharedListOfShared children)
+      : family_(std::move(family)),
+        props_(std::move(props)),
+        children_(
+            children != nullptr ? std::move(children)
+                                : std::make_shared<const ListOfShared>()) {
+    for (const auto &child : *children_) {
+      child->family_->setParent(family_);
+    }
+  }
+
+  virtual ~ShadowNode() = default;
+
+  static bool sameFamily(const ShadowNode &first, const ShadowNode &second) {
+    return first.family_ == second.family_;
+  }
+
+  Unshared clone(const ShadowNodeFragment &fragment) const;
+
+  const ListOfShared &getChildren() const {
+    return *children_;
+  }
+
+  const Props::Shared &getProps() const {
+    return props_;
+  }
+
+  const ShadowNodeFamily &getFamily() const {
+    return *family_;
+  }
+
+  const ComponentDescriptor &getComponentDescriptor() const {
+    static const ComponentDescriptor componentDescriptor;
+    return componentDescriptor;
+  }
+
+  Tag getTag() const {
+    return family_->getTag();
+  }
+
+  bool getSealed() const {
+    return sealed_;
+  }
+
+  void sealRecursive() const {
+    if (sealed_) {
+      return;
+    }
+    sealed_ = true;
+    for (const auto &child : *children_) {
+      child->sealRecursive();
+    }
+  }
+
+  void appendChild(const Shared &child) {
+    react_native_assert(!sealed_);
+    cloneChildrenIfShared();
+    std::const_pointer_cast<ListOfShared>(children_)->push_back(child);
+    child->family_->setParent(family_);
+  }
+
+  void replaceChild(
+      const ShadowNode &oldChild,
+      const Shared &newChild,
+      size_t suggestedIndex) {
+    react_native_assert(!sealed_);
+    cloneChildrenIfShared();
+    auto &children = *std::const_pointer_cast<ListOfShared>(children_);
+    newChild->family_->setParent(family_);
+    if (suggestedIndex < children.size() &&
+        children[suggestedIndex].get() == &oldChild) {
+      children[suggestedIndex] = newChild;
+      return;
+    }
+    for (auto &child : children) {
+      if (child.get() == &oldChild) {
+        child = newChild;
+        return;
+      }
+    }
+  }
+
+ private:
+  friend class ShadowNodeFamily;
+
+  void cloneChildrenIfShared() {
+    if (!childrenAreShared_) {
+      return;
+    }
+    childrenAreShared_ = false;
+    children_ = std::make_shared<const ListOfShared>(*children_);
+  }
+
+  const ShadowNodeFamily::Shared family_;
+  const Props::Shared props_;
+  SharedListOfShared children_;
+  bool childrenAreShared_ = false;
+  mutable bool sealed_ = false;
+};
+
+struct ShadowNodeFragment {
+  static const Props::Shared &propsPlaceholder() {
+    static const Props::Shared placeholder;
+    return placeholder;
+  }
+
+  static const ShadowNode::SharedListOfShared &childrenPlaceholder() {
+    static const ShadowNode::SharedListOfShared placeholder;
+    return placeholder;
+  }
+
+  const Props::Shared &props = propsPlaceholder();
+  const ShadowNode::SharedListOfShared &children = childrenPlaceholder();
+};
+
+// Every node of the model is laid out by Yoga.
+class YogaLayoutableShadowNode : public ShadowNode {
+ public:
+  using ShadowNode::ShadowNode;
+
+  void updateYogaChildren() {
+    ++updateYogaChildrenCount;
+  }
+
+  static inline size_t updateYogaChildrenCount = 0;
+};
+
+inline ShadowNode::Unshared ShadowNode::clone(
+    const ShadowNodeFragment &fragment) const {
+  auto node = std::make_shared<YogaLayoutableShadowNode>(
+      family_,
+      fragment.props != nullptr ? fragment.props : props_,
+      fragment.children != nullptr ? fragment.children : children_);
+  node->childrenAreShared_ = fragment.children == nullptr;
+  return node;
+}
+
+inline ShadowNodeFamily::AncestorList ShadowNodeFamily::getAncestors(
+    const ShadowNode &ancestorShadowNode) const {
+  std::vector<const ShadowNodeFamily *> families;
+  const auto *ancestorFamily = ancestorShadowNode.family_.get();
+  const auto *family = this;
+  while (family != nullptr && family != ancestorFamily) {
+    families.push_back(family);
+    family = family->parent_.lock().get();
+  }
+  if (family != ancestorFamily) {
+    return {};
+  }
+
+  AncestorList ancestors;
+  const auto *parentNode = &ancestorShadowNode;
+  for (auto it = families.rbegin(); it != families.rend(); ++it) {
+    const auto *childFamily = *it;
+    bool found = false;
+    int childIndex = 0;
+    for (const auto &childNode : *parentNode->children_) {
+      if (childNode->family_.get() == childFamily) {
+        ancestors.emplace_back(*parentNode, childIndex);
+        parentNode = childNode.get();
+        found = true;
+        break;
+      }
+      ++childIndex;
+    }
+    if (!found) {
+      ancestors.clear();
+      return ancestors;
+    }
+  }
+  return ancestors;
+}
+
+} // namespace facebook::react
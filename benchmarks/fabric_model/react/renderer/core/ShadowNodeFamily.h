@@ -0,0 +1,3 @@
+#pragma once
+
+#include <react/renderer/core/ShadowNode.h>
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/ShadowNode.h>
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace facebook::react {
+
+class EventHandler {
+ public:
+  virtual ~EventHandler() = default;
+};
+
+class UIManagerDelegate {};
+class UIManagerAnimationDelegate {};
+class ShadowTreeRegistry {};
+
+using SharedComponentDescriptorRegistry = std::shared_ptr<const void>;
+using RuntimeExecutor = std::function<void(std::function<void()> &&)>;
+using BackgroundExecutor = std::function<void(std::function<void()> &&)>;
+
+// Has the same layout as `UIManagerPublic` in FabricUtils.h.
+class UIManager {
+ public:
+  explicit UIManager(ContextContainer::Shared contextContainer)
+      : contextContainer_(std::move(contextContainer)) {}
+  virtual ~UIManager() = default;
+
+ private:
+  SharedComponentDescriptorRegistry componentDescriptorRegistry_;
+  UIManagerDelegate *delegate_{nullptr};
+  UIManagerAnimationDelegate *animationDelegate_{nullptr};
+  RuntimeExecutor const runtimeExecutor_{};
+  ShadowTreeRegistry shadowTreeRegistry_{};
+  BackgroundExecutor const backgroundExecutor_{};
+  ContextContainer::Shared contextContainer_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,3 @@
+#pragma once
+
+#include <react/renderer/uimanager/UIManager.h>
@@ -0,0 +1,354 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A minimal in-memory model of the JSI API, see ../README.md.
+
+#ifndef JSI_EXPORT
+#define JSI_EXPORT
+#endif
+
+namespace facebook::jsi {
+
+class Array;
+class Function;
+class Object;
+class String;
+class Value;
+
+class JSIException : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+class Runtime {
+ public:
+  virtual ~Runtime() = default;
+};
+
+class PropNameID {
+ public:
+  static PropNameID forAscii(Runtime &, const char *name) {
+    return PropNameID(name);
+  }
+
+  static PropNameID forUtf8(Runtime &, const std::string &name) {
+    return PropNameID(name);
+  }
+
+  std::string utf8(Runtime &) const {
+    return name_;
+  }
+
+ private:
+  explicit PropNameID(std::string name) : name_(std::move(name)) {}
+
+  std::string name_;
+};
+
+class String {
+ public:
+  static String createFromUtf8(Runtime &, const std::string &utf8) {
+    return String(std::make_shared<const std::string>(utf8));
+  }
+
+  static String createFromAscii(Runtime &rt, const char *ascii) {
+    return createFromUtf8(rt, ascii);
+  }
+
+  static bool strictEquals(Runtime &, const String &a, const String &b) {
+    return *a.data_ == *b.data_;
+  }
+
+  std::string utf8(Runtime &) const {
+    return *data_;
+  }
+
+ private:
+  friend class Value;
+
+  explicit String(std::shared_ptr<const std::string> data)
+      : data_(std::move(data)) {}
+
+  std::shared_ptr<const std::string> data_;
+};
+
+namespace detail {
+struct ObjectData;
+} // namespace detail
+
+class Value {
+ public:
+  Value() = default;
+  Value(bool value) : kind_(Kind::Bool), number_(value ? 1 : 0) {}
+  Value(double value) : kind_(Kind::Number), number_(value) {}
+  Value(int value) : kind_(Kind::Number), number_(value) {}
+  Value(String &&value)
+      : kind_(Kind::String), string_(std::move(value.data_)) {}
+  Value(Object &&value);
+  Value(Runtime &, const Value &other) : Value(other.copy()) {}
+  Value(Runtime &rt, const Object &object);
+
+  Value(Value &&) = default;
+  Value &operator=(Value &&) = default;
+  Value(const Value &) = delete;
+  Value &operator=(const Value &) = delete;
+
+  static Value undefined() {
+    return Value();
+  }
+
+  static Value null() {
+    Value value;
+    value.kind_ = Kind::Null;
+    return value;
+  }
+
+  bool isUndefined() const {
+    return kind_ == Kind::Undefined;
+  }
+  bool isNull() const {
+    return kind_ == Kind::Null;
+  }
+  bool isBool() const {
+    return kind_ == Kind::Bool;
+  }
+  bool isNumber() const {
+    return kind_ == Kind::Number;
+  }
+  bool isString() const {
+    return kind_ == Kind::String;
+  }
+  bool isObject() const {
+    return kind_ == Kind::Object;
+  }
+
+  bool getBool() const {
+    return number_ != 0;
+  }
+
+  double getNumber() const {
+    return number_;
+  }
+
+  double asNumber() const {
+    if (!isNumber()) {
+      throw JSIException("Value is not a number");
+    }
+    return number_;
+  }
+
+  String asString(Runtime &) const {
+    if (!isString()) {
+      throw JSIException("Value is not a string");
+    }
+    return String(string_);
+  }
+
+  Object asObject(Runtime &) const;
+  Object getObject(Runtime &rt) const;
+
+ private:
+  enum class Kind { Undefined, Null, Bool, Number, String, Object };
+
+  Value copy() const {
+    Value value;
+    value.kind_ = kind_;
+    value.number_ = number_;
+    value.string_ = string_;
+    value.object_ = object_;
+    return value;
+  }
+
+  Kind kind_ = Kind::Undefined;
+  double number_ = 0;
+  std::shared_ptr<const std::string> string_;
+  std::shared_ptr<detail::ObjectData> object_;
+};
+
+namespace detail {
+
+using HostFunctionType = std::function<
+    Value(Runtime &, const Value &thisValue, const Value *args, size_t count)>;
+
+struct ObjectData {
+  // in insertion order, like the properties of a JS object
+  std::vector<std::pair<std::string, Value>> properties;
+  bool isArray = false;
+  std::vector<Value> elements;
+  // set for functions
+  HostFunctionType hostFunction;
+};
+
+} // namespace detail
+
+// Objects are references, copies of an object share its properties.
+class Object {
+ public:
+  explicit Object(Runtime &) : data_(std::make_shared<detail::ObjectData>()) {}
+
+  Object(Object &&) = default;
+  Object &operator=(Object &&) = default;
+
+  Value getProperty(Runtime &rt, const std::string &name) const {
+    for (const auto &[key, value] : data_->properties) {
+      if (key == name) {
+        return Value(rt, value);
+      }
+    }
+    return Value::undefined();
+  }
+
+  Value getProperty(Runtime &rt, const char *name) const {
+    return getProperty(rt, std::string(name));
+  }
+
+  Value getProperty(Runtime &rt, const String &name) const {
+    return getProperty(rt, name.utf8(rt));
+  }
+
+  Value getProperty(Runtime &rt, const PropNameID &name) const {
+    return getProperty(rt, name.utf8(rt));
+  }
+
+  bool hasProperty(Runtime &rt, const std::string &name) const {
+    return !getProperty(rt, name).isUndefined();
+  }
+
+  void setProperty(Runtime &, const std::string &name, Value &&value) const {
+    for (auto &[key, existing] : data_->properties) {
+      if (key == name) {
+        existing = std::move(value);
+        return;
+      }
+    }
+    data_->properties.emplace_back(name, std::move(value));
+  }
+
+  template <typename T>
+  void setProperty(Runtime &rt, const std::string &name, T &&value) const {
+    setProperty(rt, name, Value(std::forward<T>(value)));
+  }
+
+  template <typename T>
+  void setProperty(Runtime &rt, const String &name, T &&value) const {
+    setProperty(rt, name.utf8(rt), Value(std::forward<T>(value)));
+  }
+
+  Array getPropertyNames(Runtime &rt) const;
+
+  bool isArray(Runtime &) const {
+    return data_->isArray;
+  }
+
+  Array asArray(Runtime &rt) const;
+
+ protected:
+  friend class Value;
+
+  explicit Object(std::shared_ptr<detail::ObjectData> data)
+      : data_(std::move(data)) {}
+
+  std::shared_ptr<detail::ObjectData> data_;
+};
+
+class Array : public Object {
+ public:
+  Array(Runtime &rt, size_t length) : Object(rt) {
+    data_->isArray = true;
+    data_->elements.resize(length);
+  }
+
+  size_t size(Runtime &) const {
+    return data_->elements.size();
+  }
+
+  size_t length(Runtime &rt) const {
+    return size(rt);
+  }
+
+  Value getValueAtIndex(Runtime &rt, size_t i) const {
+    return Value(rt, data_->elements.at(i));
+  }
+
+  template <typename T>
+  void setValueAtIndex(Runtime &, size_t i, T &&value) const {
+    data_->elements.at(i) = Value(std::forward<T>(value));
+  }
+
+ private:
+  friend class Object;
+
+  explicit Array(std::shared_ptr<detail::ObjectData> data)
+      : Object(std::move(data)) {}
+};
+
+// Functions are host functions only.
+class Function : public Object {
+ public:
+  static Function createFromHostFunction(
+      Runtime &rt,
+      const PropNameID &,
+      unsigned int,
+      detail::HostFunctionType hostFunction) {
+    Function function(rt);
+    function.data_->hostFunction = std::move(hostFunction);
+    return function;
+  }
+
+  Function(Function &&) = default;
+  Function &operator=(Function &&) = default;
+
+  template <typename... Args>
+  Value call(Runtime &rt, Args &&...args) const {
+    // the leading value keeps the array non-empty
+    Value arguments[] = {
+        Value::undefined(), Value(std::forward<Args>(args))...};
+    return data_->hostFunction(
+        rt, Value::undefined(), arguments + 1, sizeof...(Args));
+  }
+
+ private:
+  explicit Function(Runtime &rt) : Object(rt) {}
+};
+
+inline Value::Value(Object &&value)
+    : kind_(Kind::Object), object_(std::move(value.data_)) {}
+
+inline Value::Value(Runtime &, const Object &object)
+    : kind_(Kind::Object), object_(object.data_) {}
+
+inline Object Value::asObject(Runtime &) const {
+  if (!isObject()) {
+    throw JSIException("Value is not an object");
+  }
+  return Object(object_);
+}
+
+inline Object Value::getObject(Runtime &rt) const {
+  return asObject(rt);
+}
+
+inline Array Object::getPropertyNames(Runtime &rt) const {
+  Array names(rt, data_->properties.size());
+  for (size_t i = 0; i < data_->properties.size(); ++i) {
+    names.setValueAtIndex(
+        rt, i, String::createFromUtf8(rt, data_->properties[i].first));
+  }
+  return names;
+}
+
+inline Array Object::asArray(Runtime &) const {
+  if (!data_->isArray) {
+    throw JSIException("Object is not an array");
+  }
+  return Array(data_);
+}
+
+} // namespace facebook::jsi
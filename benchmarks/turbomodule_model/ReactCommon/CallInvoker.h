@@ -0,0 +1,12 @@
+#pragma once
+
+// A host model of CallInvoker, see ../README.md.
+
+namespace facebook::react {
+
+class CallInvoker {
+ public:
+  virtual ~CallInvoker() = default;
+};
+
+} // namespace facebook::react
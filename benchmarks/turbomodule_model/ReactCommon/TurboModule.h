@@ -0,0 +1,39 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "CallInvoker.h"
+
+// A host model of TurboModule, see ../README.md.
+
+namespace facebook::react {
+
+class TurboModule {
+ public:
+  TurboModule(std::string name, std::shared_ptr<CallInvoker> jsInvoker)
+      : name_(std::move(name)), jsInvoker_(std::move(jsInvoker)) {}
+
+  virtual ~TurboModule() = default;
+
+  struct MethodMetadata {
+    size_t argCount;
+    jsi::Value (*invoker)(
+        jsi::Runtime &rt,
+        TurboModule &turboModule,
+        const jsi::Value *args,
+        size_t count);
+  };
+
+ protected:
+  const std::string name_;
+  std::shared_ptr<CallInvoker> jsInvoker_;
+  std::unordered_map<std::string, MethodMetadata> methodMap_;
+};
+
+} // namespace facebook::react
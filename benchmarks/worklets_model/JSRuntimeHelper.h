@@ -0,0 +1,32 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <functional>
+#include <utility>
+
+// A host model of JSRuntimeHelper, see README.md.
+
+using namespace facebook;
+
+namespace reanimated {
+
+class JSRuntimeHelper {
+ public:
+  // Called instead of running `function`, with the timestamp and the event
+  // passed by WorkletEventHandler.
+  std::function<void(
+      const jsi::Value &function,
+      const jsi::Value &eventTimestamp,
+      const jsi::Value &event)>
+      onRun;
+
+  template <typename... Args>
+  void runOnUIGuarded(const jsi::Value &function, Args &&...args) {
+    if (onRun) {
+      onRun(function, std::forward<Args>(args)...);
+    }
+  }
+};
+
+} // namespace reanimated
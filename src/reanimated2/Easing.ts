@@ -53,7 +53,11 @@ export type EasingFunction = (t: number) => number;
  */
 export type EasingFn = EasingFunction;
 
-export type EasingFunctionFactory = { factory: () => EasingFunction };
+export type EasingFunctionFactory = {
+  factory: () => EasingFunction;
+  // set by `bezier`, lets the animation run on the native driver
+  controlPoints?: [number, number, number, number];
+};
 
 /**
  * @deprecated Please use `EasingFunctionFactory` type instead.
@@ -219,13 +223,14 @@ function bezier(
   y1: number,
   x2: number,
   y2: number
-): { factory: () => (x: number) => number } {
+): EasingFunctionFactory {
   'worklet';
   return {
     factory: () => {
       'worklet';
       return Bezier(x1, y1, x2, y2);
     },
+    controlPoints: [x1, y1, x2, y2],
   };
 }
 
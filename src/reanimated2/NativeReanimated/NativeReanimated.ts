@@ -1,5 +1,6 @@
 import { NativeModules } from 'react-native';
 import type {
+  PropsUpdateStats,
   ShareableRef,
   ShareableSyncDataHolderRef,
   Value3D,
@@ -29,12 +30,28 @@ export interface NativeReanimatedModule {
   ): ShareableSyncDataHolderRef<T>;
   getDataSynchronously<T>(ref: ShareableSyncDataHolderRef<T>): T;
   scheduleOnUI<T>(shareable: ShareableRef<T>): void;
+  startBackgroundRuntimes<T>(
+    count: number | undefined,
+    initializer: ShareableRef<T> | undefined
+  ): void;
+  scheduleOnBackground<T, R>(
+    shareable: ShareableRef<T>,
+    onResult: ShareableRef<R> | undefined
+  ): void;
   registerEventHandler<T>(
     eventHandler: ShareableRef<T>,
     eventName: string,
-    emitterReactTag: number
+    emitterReactTag: number,
+    shouldConsumeEvent: boolean,
+    shouldCoalesceEvents: boolean
   ): number;
   unregisterEventHandler(id: number): void;
+  registerFrameCallback<T>(callback: ShareableRef<T>): number;
+  unregisterFrameCallback(callbackId: number): void;
+  setFrameCallbackActive(callbackId: number, isActive: boolean): void;
+  getFrameTimingTrace(): string;
+  getPropsUpdateStats(): PropsUpdateStats;
+  setPropsUpdateEpsilon(epsilon: number): void;
   getViewProp<T>(
     viewTag: number,
     propName: string,
@@ -113,6 +130,20 @@ See https://docs.swmansion.com/react-native-reanimated/docs/guides/troubleshooti
     return this.InnerNativeModule.scheduleOnUI(shareable);
   }
 
+  startBackgroundRuntimes<T>(
+    count: number | undefined,
+    initializer: ShareableRef<T> | undefined
+  ) {
+    this.InnerNativeModule.startBackgroundRuntimes(count, initializer);
+  }
+
+  scheduleOnBackground<T, R>(
+    shareable: ShareableRef<T>,
+    onResult: ShareableRef<R> | undefined
+  ) {
+    this.InnerNativeModule.scheduleOnBackground(shareable, onResult);
+  }
+
   registerSensor(
     sensorType: number,
     interval: number,
@@ -134,12 +165,16 @@ See https://docs.swmansion.com/react-native-reanimated/docs/guides/troubleshooti
   registerEventHandler<T>(
     eventHandler: ShareableRef<T>,
     eventName: string,
-    emitterReactTag: number
+    emitterReactTag: number,
+    shouldConsumeEvent: boolean,
+    shouldCoalesceEvents: boolean
   ) {
     return this.InnerNativeModule.registerEventHandler(
       eventHandler,
       eventName,
-      emitterReactTag
+      emitterReactTag,
+      shouldConsumeEvent,
+      shouldCoalesceEvents
     );
   }
 
@@ -147,6 +182,30 @@ See https://docs.swmansion.com/react-native-reanimated/docs/guides/troubleshooti
     return this.InnerNativeModule.unregisterEventHandler(id);
   }
 
+  registerFrameCallback<T>(callback: ShareableRef<T>) {
+    return this.InnerNativeModule.registerFrameCallback(callback);
+  }
+
+  unregisterFrameCallback(callbackId: number) {
+    this.InnerNativeModule.unregisterFrameCallback(callbackId);
+  }
+
+  setFrameCallbackActive(callbackId: number, isActive: boolean) {
+    this.InnerNativeModule.setFrameCallbackActive(callbackId, isActive);
+  }
+
+  getFrameTimingTrace() {
+    return this.InnerNativeModule.getFrameTimingTrace();
+  }
+
+  getPropsUpdateStats() {
+    return this.InnerNativeModule.getPropsUpdateStats();
+  }
+
+  setPropsUpdateEpsilon(epsilon: number) {
+    this.InnerNativeModule.setPropsUpdateEpsilon(epsilon);
+  }
+
   getViewProp<T>(
     viewTag: number,
     propName: string,
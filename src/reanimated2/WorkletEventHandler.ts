@@ -14,13 +14,22 @@ function jsListener<T extends NativeEvent<T>>(
 export default class WorkletEventHandler<T extends NativeEvent<T>> {
   worklet: (event: T) => void;
   eventNames: string[];
+  shouldConsumeEvents: boolean;
+  shouldCoalesceEvents: boolean;
   reattachNeeded: boolean;
   listeners: Record<string, (event: T) => void>;
   viewTag: number | undefined;
   registrations: number[];
-  constructor(worklet: (event: T) => void, eventNames: string[] = []) {
+  constructor(
+    worklet: (event: T) => void,
+    eventNames: string[] = [],
+    shouldConsumeEvents = false,
+    shouldCoalesceEvents = false
+  ) {
     this.worklet = worklet;
     this.eventNames = eventNames;
+    this.shouldConsumeEvents = shouldConsumeEvents;
+    this.shouldCoalesceEvents = shouldCoalesceEvents;
     this.reattachNeeded = false;
     this.listeners = {};
     this.viewTag = undefined;
@@ -45,11 +54,23 @@ export default class WorkletEventHandler<T extends NativeEvent<T>> {
   registerForEvents(viewTag: number, fallbackEventName?: string): void {
     this.viewTag = viewTag;
     this.registrations = this.eventNames.map((eventName) =>
-      registerEventHandler(this.worklet, eventName, viewTag)
+      registerEventHandler(
+        this.worklet,
+        eventName,
+        viewTag,
+        this.shouldConsumeEvents,
+        this.shouldCoalesceEvents
+      )
     );
     if (this.registrations.length === 0 && fallbackEventName) {
       this.registrations.push(
-        registerEventHandler(this.worklet, fallbackEventName, viewTag)
+        registerEventHandler(
+          this.worklet,
+          fallbackEventName,
+          viewTag,
+          this.shouldConsumeEvents,
+          this.shouldCoalesceEvents
+        )
       );
     }
   }
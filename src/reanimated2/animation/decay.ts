@@ -6,6 +6,7 @@ import type {
   AnimatableValue,
   Timestamp,
   ReduceMotion,
+  NativeAnimationConfig,
 } from '../commonTypes';
 import { isWeb } from '../PlatformChecker';
 
@@ -196,9 +197,33 @@ export const withDecay = function (
       }
     }
 
+    function toNativeConfig(
+      animation: InnerDecayAnimation
+    ): NativeAnimationConfig | undefined {
+      if (IS_WEB) {
+        // the native driver uses the velocity threshold of native platforms
+        return undefined;
+      }
+      return {
+        type: 'decay',
+        current: animation.current,
+        velocity: animation.velocity,
+        lastTimestamp: animation.lastTimestamp,
+        startTimestamp: animation.startTimestamp,
+        initialVelocity: animation.initialVelocity,
+        deceleration: config.deceleration,
+        velocityFactor: config.velocityFactor,
+        rubberBandFactor: config.rubberBandFactor,
+        clamp: config.clamp,
+        rubberBandEffect: !!config.rubberBandEffect,
+        springActive: !!animation.springActive,
+      };
+    }
+
     return {
       onFrame: decay,
       onStart,
+      toNativeConfig,
       callback,
       velocity: config.velocity ?? 0,
       initialVelocity: 0,
@@ -4,6 +4,7 @@ import type {
   AnimationCallback,
   AnimatableValue,
   Timestamp,
+  NativeAnimationConfig,
 } from '../commonTypes';
 import type {
   SpringConfig,
@@ -222,9 +223,36 @@ export const withSpring = ((
         : now;
     }
 
+    function toNativeConfig(
+      animation: InnerSpringAnimation
+    ): NativeAnimationConfig | undefined {
+      if (typeof animation.toValue !== 'number') {
+        return undefined;
+      }
+      return {
+        type: 'spring',
+        current: animation.current,
+        velocity: animation.velocity,
+        lastTimestamp: animation.lastTimestamp,
+        startTimestamp: animation.startTimestamp,
+        startValue: animation.startValue,
+        toValue: animation.toValue,
+        zeta: animation.zeta,
+        omega0: animation.omega0,
+        omega1: animation.omega1,
+        duration: config.duration,
+        restDisplacementThreshold: config.restDisplacementThreshold,
+        restSpeedThreshold: config.restSpeedThreshold,
+        useDuration: config.useDuration,
+        configIsInvalid: config.configIsInvalid,
+        overshootClamping: !!config.overshootClamping,
+      };
+    }
+
     return {
       onFrame: springOnFrame,
       onStart,
+      toNativeConfig,
       toValue,
       velocity: config.velocity || 0,
       current: toValue,
@@ -7,6 +7,7 @@ import type {
   Timestamp,
   AnimatableValue,
   ReduceMotion,
+  NativeAnimationConfig,
 } from '../commonTypes';
 
 interface TimingConfig {
@@ -49,9 +50,10 @@ export const withTiming = function (
 
   return defineAnimation<TimingAnimation>(toValue, () => {
     'worklet';
+    const defaultEasing = Easing.inOut(Easing.quad);
     const config: Required<Omit<TimingConfig, 'reduceMotion'>> = {
       duration: 300,
-      easing: Easing.inOut(Easing.quad),
+      easing: defaultEasing,
     };
     if (userConfig) {
       Object.keys(userConfig).forEach(
@@ -107,9 +109,39 @@ export const withTiming = function (
       }
     }
 
+    function toNativeConfig(
+      animation: InnerTimingAnimation
+    ): NativeAnimationConfig | undefined {
+      if (typeof animation.toValue !== 'number') {
+        return undefined;
+      }
+      let easing: 'inOutQuad' | [number, number, number, number];
+      if (config.easing === defaultEasing) {
+        easing = 'inOutQuad';
+      } else if (
+        typeof config.easing === 'object' &&
+        config.easing.controlPoints
+      ) {
+        easing = config.easing.controlPoints;
+      } else {
+        // other easings can only be run in JS
+        return undefined;
+      }
+      return {
+        type: 'timing',
+        current: animation.current,
+        startTime: animation.startTime,
+        startValue: animation.startValue as number,
+        toValue: animation.toValue,
+        duration: config.duration,
+        easing,
+      };
+    }
+
     return {
       type: 'timing',
       onFrame: timing,
+      toNativeConfig,
       onStart: onStart as (animation: TimingAnimation, now: number) => boolean,
       progress: 0,
       toValue,
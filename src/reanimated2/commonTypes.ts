@@ -118,6 +118,53 @@ export type AnimatableValueObject = { [key: string]: Animatable };
 
 export type AnimatableValue = Animatable | AnimatableValueObject;
 
+// State of a running `withTiming`, `withSpring` or `withDecay` animation of a
+// number, used to continue it in the native animation driver. See
+// NumericAnimations.h for the meaning of the fields.
+export type NativeAnimationConfig =
+  | {
+      type: 'timing';
+      current: number;
+      startTime: Timestamp;
+      startValue: number;
+      toValue: number;
+      duration: number;
+      // `Easing.inOut(Easing.quad)` or the control points of `Easing.bezier`
+      easing: 'inOutQuad' | [number, number, number, number];
+    }
+  | {
+      type: 'spring';
+      current: number;
+      velocity: number;
+      lastTimestamp: Timestamp;
+      startTimestamp: Timestamp;
+      startValue: number;
+      toValue: number;
+      zeta: number;
+      omega0: number;
+      omega1: number;
+      duration: number;
+      restDisplacementThreshold: number;
+      restSpeedThreshold: number;
+      useDuration: boolean;
+      configIsInvalid: boolean;
+      overshootClamping: boolean;
+    }
+  | {
+      type: 'decay';
+      current: number;
+      velocity: number;
+      lastTimestamp: Timestamp;
+      startTimestamp: Timestamp;
+      initialVelocity: number;
+      deceleration: number;
+      velocityFactor: number;
+      rubberBandFactor: number;
+      clamp?: number[];
+      rubberBandEffect: boolean;
+      springActive: boolean;
+    };
+
 export interface AnimationObject {
   [key: string]: any;
   callback?: AnimationCallback;
@@ -131,6 +178,9 @@ export interface AnimationObject {
 
   __prefix?: string;
   __suffix?: string;
+  // Returns undefined when the animation can only be run in JS.
+  toNativeConfig?: (animation: any) => NativeAnimationConfig | undefined;
+  __nativeAnimationId?: number;
   onFrame: (animation: any, timestamp: Timestamp) => boolean;
   onStart: (
     nextAnimation: any,
@@ -238,6 +288,26 @@ export interface AnimatedKeyboardOptions {
   isStatusBarTranslucentAndroid?: boolean;
 }
 
+export interface PropsUpdateStats {
+  // props sent to the native views
+  sentProps: number;
+  // props dropped because they were equal to the ones sent before
+  suppressedProps: number;
+  // updates dropped as a whole because none of their props changed
+  suppressedUpdates: number;
+  // updates applied by performOperations
+  propsUpdates: number;
+  // prop values converted from JSI, at most one per prop of an update
+  jsiPropsConversions: number;
+  // RawProps built from updates for commits on the UI thread, one per update
+  // and commit attempt
+  rawPropsConversions: number;
+  // views found in the tree through the path remembered from previous commits
+  ancestorPathHits: number;
+  // views which had to be searched for in the tree
+  ancestorPathMisses: number;
+}
+
 /**
  * - `System` - If the `Reduce motion` accessibility setting is enabled on the device, disable the animation. Otherwise, enable the animation.
  * - `Always` - Disable the animation.
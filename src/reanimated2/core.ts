@@ -2,6 +2,7 @@ import NativeReanimatedModule from './NativeReanimated';
 import { nativeShouldBeMock, isWeb } from './PlatformChecker';
 import type {
   AnimatedKeyboardOptions,
+  PropsUpdateStats,
   SensorConfig,
   SensorType,
   SharedValue,
@@ -21,7 +22,13 @@ import type {
 import { SensorContainer } from './SensorContainer';
 
 export { startMapper, stopMapper } from './mappers';
-export { runOnJS, runOnUI } from './threads';
+export {
+  runOnJS,
+  runOnUI,
+  runOnBackground,
+  startBackgroundRuntimes,
+} from './threads';
+export type { RunOnJSOptions } from './threads';
 export { makeShareable } from './shareables';
 export { makeMutable, makeRemote } from './mutables';
 
@@ -69,6 +76,26 @@ export function getViewProp<T>(viewTag: number, propName: string): Promise<T> {
   });
 }
 
+// Returns the time the UI thread spent in each phase of the recent frames in
+// the Chrome trace event format, it can be opened in chrome://tracing or
+// Perfetto.
+export function getFrameTimingTrace(): string {
+  return NativeReanimatedModule.getFrameTimingTrace();
+}
+
+// Returns how many animated props were sent to the native views and how many
+// were dropped because they didn't change. Props are filtered only on Fabric.
+export function getPropsUpdateStats(): PropsUpdateStats {
+  return NativeReanimatedModule.getPropsUpdateStats();
+}
+
+// Numbers, also the ones nested in e.g. transforms, which differ by at most
+// `epsilon` from the value sent to the view before, aren't sent again. Useful
+// to skip sub-pixel changes, 0 by default.
+export function setPropsUpdateEpsilon(epsilon: number): void {
+  NativeReanimatedModule.setPropsUpdateEpsilon(epsilon);
+}
+
 function getSensorContainer(): SensorContainer {
   if (!global.__sensorContainer) {
     global.__sensorContainer = new SensorContainer();
@@ -79,7 +106,9 @@ function getSensorContainer(): SensorContainer {
 export function registerEventHandler<T>(
   eventHandler: (event: T) => void,
   eventName: string,
-  emitterReactTag = -1
+  emitterReactTag = -1,
+  shouldConsumeEvent = false,
+  shouldCoalesceEvents = false
 ): number {
   function handleAndFlushAnimationFrame(eventTimestamp: number, event: T) {
     'worklet';
@@ -91,7 +120,9 @@ export function registerEventHandler<T>(
   return NativeReanimatedModule.registerEventHandler(
     makeShareableCloneRecursive(handleAndFlushAnimationFrame),
     eventName,
-    emitterReactTag
+    emitterReactTag,
+    shouldConsumeEvent,
+    shouldCoalesceEvents
   );
 }
 
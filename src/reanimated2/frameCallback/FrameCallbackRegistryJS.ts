@@ -1,12 +1,21 @@
 import { runOnUI } from '../core';
+import NativeReanimatedModule from '../NativeReanimated';
+import { shouldBeUseWeb } from '../PlatformChecker';
+import { makeShareableCloneRecursive } from '../shareables';
+import { callMicrotasks } from '../threads';
 import type { FrameInfo } from './FrameCallbackRegistryUI';
 import { prepareUIRegistry } from './FrameCallbackRegistryUI';
 
+const IS_NATIVE = !shouldBeUseWeb();
+
 export default class FrameCallbackRegistryJS {
   private nextCallbackId = 0;
 
   constructor() {
-    prepareUIRegistry();
+    if (!IS_NATIVE) {
+      // on native the registry lives in C++, see FrameCallbackRegistry.h
+      prepareUIRegistry();
+    }
   }
 
   registerFrameCallback(callback: (frameInfo: FrameInfo) => void): number {
@@ -14,6 +23,19 @@ export default class FrameCallbackRegistryJS {
       return -1;
     }
 
+    if (IS_NATIVE) {
+      return NativeReanimatedModule.registerFrameCallback(
+        makeShareableCloneRecursive((frameInfo: FrameInfo) => {
+          'worklet';
+          // same frame boundaries as callbacks run by requestAnimationFrame
+          global.__frameTimestamp = frameInfo.timestamp;
+          callback(frameInfo);
+          global.__frameTimestamp = undefined;
+          callMicrotasks();
+        })
+      );
+    }
+
     const callbackId = this.nextCallbackId;
     this.nextCallbackId++;
 
@@ -25,12 +47,26 @@ export default class FrameCallbackRegistryJS {
   }
 
   unregisterFrameCallback(callbackId: number): void {
+    if (callbackId === -1) {
+      return;
+    }
+    if (IS_NATIVE) {
+      NativeReanimatedModule.unregisterFrameCallback(callbackId);
+      return;
+    }
     runOnUI(() => {
       global._frameCallbackRegistry.unregisterFrameCallback(callbackId);
     })();
   }
 
   manageStateFrameCallback(callbackId: number, state: boolean): void {
+    if (callbackId === -1) {
+      return;
+    }
+    if (IS_NATIVE) {
+      NativeReanimatedModule.setFrameCallbackActive(callbackId, state);
+      return;
+    }
     runOnUI(() => {
       global._frameCallbackRegistry.manageStateFrameCallback(callbackId, state);
     })();
@@ -25,6 +25,7 @@ export interface FrameCallbackRegistryUI {
   manageStateFrameCallback: (callbackId: number, state: boolean) => void;
 }
 
+// Only used on web and in Jest, native platforms keep the registry in C++.
 export const prepareUIRegistry = runOnUIImmediately(() => {
   'worklet';
 
@@ -9,6 +9,9 @@ import type {
   ShadowNodeWrapper,
   ComplexWorkletFunction,
   FlatShareableRef,
+  AnimationObject,
+  NativeAnimationConfig,
+  SharedValue,
 } from './commonTypes';
 import type { AnimatedStyle } from './helperTypes';
 import type { FrameCallbackRegistryUI } from './frameCallback/FrameCallbackRegistryUI';
@@ -43,9 +46,24 @@ declare global {
     dataHolder: ShareableSyncDataHolderRef<any>,
     data: ShareableRef<any>
   ) => void;
+  var _startNativeAnimation: (
+    sharedValue: SharedValue<number>,
+    animation: AnimationObject,
+    config: NativeAnimationConfig
+  ) => number;
+  var _stopNativeAnimation: (animationId: number) => void;
+  var _startMapper: (
+    mapperId: number,
+    worklet: () => void,
+    inputIds: number[],
+    outputIds: number[]
+  ) => void;
+  var _stopMapper: (mapperId: number) => void;
+  var _markMapperInputDirty: (sharedValueId: number) => void;
   var _scheduleOnJS: (
     fun: ComplexWorkletFunction<A, R>,
-    args?: unknown[]
+    args: unknown[] | undefined,
+    latestWins: boolean
   ) => void;
   var _updatePropsPaper:
     | ((
@@ -31,17 +31,26 @@ interface UseHandlerContext<TContext extends Context> {
 type useEventType = <T extends object>(
   handler: (e: T) => void,
   eventNames?: string[],
-  rebuild?: boolean
+  rebuild?: boolean,
+  shouldConsumeEvents?: boolean,
+  shouldCoalesceEvents?: boolean
 ) => (e: NativeSyntheticEvent<T>) => void;
 
 export const useEvent = function <T extends NativeEvent<T>>(
   handler: (event: T) => void,
   eventNames: string[] = [],
-  rebuild = false
+  rebuild = false,
+  shouldConsumeEvents = false,
+  shouldCoalesceEvents = false
 ): MutableRefObject<WorkletEventHandler<T> | null> {
   const initRef = useRef<WorkletEventHandler<T> | null>(null);
   if (initRef.current === null) {
-    initRef.current = new WorkletEventHandler(handler, eventNames);
+    initRef.current = new WorkletEventHandler(
+      handler,
+      eventNames,
+      shouldConsumeEvents,
+      shouldCoalesceEvents
+    );
   } else if (rebuild) {
     initRef.current.updateWorklet(handler);
   }
@@ -3,11 +3,16 @@ import './publicGlobals';
 export {
   runOnJS,
   runOnUI,
+  runOnBackground,
+  startBackgroundRuntimes,
   makeMutable,
   isReanimated3,
   isConfigured,
   enableLayoutAnimations,
   getViewProp,
+  getFrameTimingTrace,
+  getPropsUpdateStats,
+  setPropsUpdateEpsilon,
 } from './core';
 export {
   useAnimatedProps,
@@ -227,6 +232,7 @@ export {
   MeasuredDimensions,
   AnimatedKeyboardOptions,
   ReduceMotion,
+  PropsUpdateStats,
 } from './commonTypes';
 export { FrameInfo } from './frameCallback';
 export { getUseOfValueInStyleWarning } from './pluginUtils';
@@ -251,3 +257,4 @@ export type {
 } from './helperTypes';
 export type { AnimatedScrollViewProps } from './component/ScrollView';
 export type { FlatListPropsWithLayout } from './component/FlatList';
+export type { RunOnJSOptions } from './core';
@@ -1,5 +1,6 @@
 import { isChromeDebugger, isJest, isWeb } from '../PlatformChecker';
 import type {
+  PropsUpdateStats,
   ShareableRef,
   ShareableSyncDataHolderRef,
   Value3D,
@@ -35,10 +36,28 @@ export default class JSReanimated {
     requestAnimationFrame(worklet);
   }
 
+  startBackgroundRuntimes<T>(
+    _count: number | undefined,
+    _initializer: ShareableRef<T> | undefined
+  ): void {
+    // noop
+  }
+
+  scheduleOnBackground<T, R>(
+    _shareable: ShareableRef<T>,
+    _onResult: ShareableRef<R> | undefined
+  ): void {
+    throw new Error(
+      '[Reanimated] scheduleOnBackground is not available in JSReanimated.'
+    );
+  }
+
   registerEventHandler<T>(
     _eventHandler: ShareableRef<T>,
     _eventName: string,
-    _emitterReactTag: number
+    _emitterReactTag: number,
+    _shouldConsumeEvent: boolean,
+    _shouldCoalesceEvents: boolean
   ): number {
     // noop
     return -1;
@@ -264,6 +283,47 @@ export default class JSReanimated {
     );
   }
 
+  registerFrameCallback<T>(_callback: ShareableRef<T>): number {
+    throw new Error(
+      '[Reanimated] registerFrameCallback is not available in JSReanimated.'
+    );
+  }
+
+  unregisterFrameCallback(_callbackId: number): void {
+    throw new Error(
+      '[Reanimated] unregisterFrameCallback is not available in JSReanimated.'
+    );
+  }
+
+  setFrameCallbackActive(_callbackId: number, _isActive: boolean): void {
+    throw new Error(
+      '[Reanimated] setFrameCallbackActive is not available in JSReanimated.'
+    );
+  }
+
+  getFrameTimingTrace(): string {
+    // frames aren't instrumented on web
+    return '{"traceEvents":[]}';
+  }
+
+  getPropsUpdateStats(): PropsUpdateStats {
+    // updates aren't filtered on web
+    return {
+      sentProps: 0,
+      suppressedProps: 0,
+      suppressedUpdates: 0,
+      propsUpdates: 0,
+      jsiPropsConversions: 0,
+      rawPropsConversions: 0,
+      ancestorPathHits: 0,
+      ancestorPathMisses: 0,
+    };
+  }
+
+  setPropsUpdateEpsilon(_epsilon: number): void {
+    // noop
+  }
+
   getViewProp<T>(
     _viewTag: number,
     _propName: string,
@@ -1,9 +1,10 @@
 import type { SharedValue } from './commonTypes';
-import { isJest } from './PlatformChecker';
+import { isJest, shouldBeUseWeb } from './PlatformChecker';
 import { runOnUI } from './threads';
 import { isSharedValue } from './utils';
 
 const IS_JEST = isJest();
+const IS_NATIVE = !shouldBeUseWeb();
 
 type Mapper = {
   id: number;
@@ -13,6 +14,31 @@ type Mapper = {
   outputs?: SharedValue<any>[];
 };
 
+function extractInputs(
+  inputs: any,
+  resultArray: SharedValue<any>[]
+): SharedValue<any>[] {
+  'worklet';
+  function extractRecursive(inputs: any) {
+    if (Array.isArray(inputs)) {
+      for (const input of inputs) {
+        input && extractRecursive(input);
+      }
+    } else if (isSharedValue(inputs)) {
+      resultArray.push(inputs);
+    } else if (Object.getPrototypeOf(inputs) === Object.prototype) {
+      // we only extract inputs recursively from "plain" objects here, if object
+      // is of a derivative class (e.g. HostObject on web, or Map) we don't scan
+      // it recursively
+      for (const element of Object.values(inputs)) {
+        element && extractRecursive(element);
+      }
+    }
+  }
+  extractRecursive(inputs);
+  return resultArray;
+}
+
 function createMapperRegistry() {
   'worklet';
   const mappers = new Map();
@@ -127,27 +153,6 @@ function createMapperRegistry() {
     }
   }
 
-  function extractInputs(
-    inputs: any,
-    resultArray: SharedValue<any>[]
-  ): SharedValue<any>[] {
-    if (Array.isArray(inputs)) {
-      for (const input of inputs) {
-        input && extractInputs(input, resultArray);
-      }
-    } else if (isSharedValue(inputs)) {
-      resultArray.push(inputs);
-    } else if (Object.getPrototypeOf(inputs) === Object.prototype) {
-      // we only extract inputs recursively from "plain" objects here, if object
-      // is of a derivative class (e.g. HostObject on web, or Map) we don't scan
-      // it recursively
-      for (const element of Object.values(inputs)) {
-        element && extractInputs(element, resultArray);
-      }
-    }
-    return resultArray;
-  }
-
   return {
     start: (
       mapperID: number,
@@ -185,6 +190,59 @@ function createMapperRegistry() {
   };
 }
 
+type UIMutable = SharedValue<any> & {
+  _id: number;
+  _mapperInputs: number;
+};
+
+// On native platforms the dependency graph lives in C++ (MapperRegistry.cpp).
+// Writes to a shared value that's an input of some mapper mark the mappers
+// reading it as dirty there and only the dirty mappers run, in topological
+// order.
+function createNativeMapperRegistry() {
+  'worklet';
+  let nextSharedValueId = 1;
+  const mapperInputs = new Map<number, UIMutable[]>();
+
+  function getSharedValueId(sv: UIMutable) {
+    if (sv._id === 0) {
+      sv._id = nextSharedValueId++;
+    }
+    return sv._id;
+  }
+
+  return {
+    start: (
+      mapperID: number,
+      worklet: () => void,
+      inputs: SharedValue<any>[],
+      outputs?: SharedValue<any>[]
+    ) => {
+      const inputValues = extractInputs(inputs, []) as UIMutable[];
+      for (const sv of inputValues) {
+        sv._mapperInputs += 1;
+      }
+      mapperInputs.set(mapperID, inputValues);
+      global._startMapper(
+        mapperID,
+        worklet,
+        inputValues.map(getSharedValueId),
+        ((outputs ?? []) as UIMutable[]).map(getSharedValueId)
+      );
+    },
+    stop: (mapperID: number) => {
+      const inputValues = mapperInputs.get(mapperID);
+      if (inputValues) {
+        mapperInputs.delete(mapperID);
+        for (const sv of inputValues) {
+          sv._mapperInputs -= 1;
+        }
+        global._stopMapper(mapperID);
+      }
+    },
+  };
+}
+
 let MAPPER_ID = 9999;
 
 export function startMapper(
@@ -197,7 +255,9 @@ export function startMapper(
   runOnUI(() => {
     let mapperRegistry = global.__mapperRegistry;
     if (mapperRegistry === undefined) {
-      mapperRegistry = global.__mapperRegistry = createMapperRegistry();
+      mapperRegistry = global.__mapperRegistry = IS_NATIVE
+        ? createNativeMapperRegistry()
+        : createMapperRegistry();
     }
     mapperRegistry.start(mapperID, worklet, inputs, outputs);
   })();
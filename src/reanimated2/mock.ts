@@ -139,6 +139,20 @@ const ReanimatedV2 = {
 
   runOnJS: (fn) => fn,
   runOnUI: (fn) => fn,
+  runOnBackground: (fn, onResult) => (...args) => onResult?.(fn(...args)),
+  startBackgroundRuntimes: NOOP,
+  getFrameTimingTrace: () => '{"traceEvents":[]}',
+  getPropsUpdateStats: () => ({
+    sentProps: 0,
+    suppressedProps: 0,
+    suppressedUpdates: 0,
+    propsUpdates: 0,
+    jsiPropsConversions: 0,
+    rawPropsConversions: 0,
+    ancestorPathHits: 0,
+    ancestorPathMisses: 0,
+  }),
+  setPropsUpdateEpsilon: NOOP,
 };
 
 [
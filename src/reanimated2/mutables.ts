@@ -41,6 +41,9 @@ export function makeUIMutable<T>(
       listeners.forEach((listener) => {
         listener(newValue);
       });
+      if (self._mapperInputs > 0) {
+        global._markMapperInputDirty(self._id);
+      }
     },
     get _value(): T {
       return value;
@@ -53,6 +56,9 @@ export function makeUIMutable<T>(
     },
     _animation: null,
     _isReanimatedSharedValue: true,
+    // maintained by the native mapper registry, see mappers.ts
+    _id: 0,
+    _mapperInputs: 0,
   };
   return self;
 }
@@ -160,8 +160,18 @@ function runWorkletOnJS<A extends any[], R>(
   worklet(...args);
 }
 
+export interface RunOnJSOptions {
+  /**
+   * When set, only the last call of `fun` made on the UI thread during a
+   * single frame or event is executed on the JS thread. Useful for progress
+   * callbacks where intermediate values are not needed. Ignored for worklets.
+   */
+  latestWins?: boolean;
+}
+
 export function runOnJS<A extends any[], R>(
-  fun: ComplexWorkletFunction<A, R>
+  fun: ComplexWorkletFunction<A, R>,
+  options?: RunOnJSOptions
 ): (...args: A) => void {
   'worklet';
   if (!IS_NATIVE || !_WORKLET) {
@@ -185,7 +195,87 @@ export function runOnJS<A extends any[], R>(
       fun,
       args.length > 0
         ? (makeShareableCloneOnUIRecursive(args) as unknown as unknown[])
-        : undefined
+        : undefined,
+      options?.latestWins === true
+    );
+  };
+}
+
+let backgroundRuntimesStarted = false;
+
+/**
+ * Starts `count` background worklet runtimes, each on its own thread. Worklets
+ * scheduled with `runOnBackground` are distributed between them. When `count`
+ * is not provided the number of runtimes is based on the number of CPU cores.
+ * At most 16 runtimes are started.
+ * Runtimes can only be started once, subsequent calls have no effect. Shared
+ * values already used on the UI thread can't be captured by background worklets
+ * afterwards, so call it before such shared values are created.
+ */
+export function startBackgroundRuntimes(count?: number) {
+  if (!IS_NATIVE || backgroundRuntimesStarted) {
+    return;
+  }
+  backgroundRuntimesStarted = true;
+  const capturableConsole = { ...console };
+  NativeReanimatedModule.startBackgroundRuntimes(
+    count,
+    makeShareableCloneRecursive(() => {
+      'worklet';
+      // @ts-ignore TypeScript doesn't like that there are missing methods in console object, but we don't provide all the methods for the background runtime console version
+      global.console = {
+        assert: runOnJS(capturableConsole.assert),
+        debug: runOnJS(capturableConsole.debug),
+        log: runOnJS(capturableConsole.log),
+        warn: runOnJS(capturableConsole.warn),
+        error: runOnJS(capturableConsole.error),
+        info: runOnJS(capturableConsole.info),
+      };
+    })
+  );
+}
+
+/**
+ * Schedule a worklet to execute on one of the background worklet runtimes, so
+ * that heavy computations don't compete with animations on the UI thread.
+ * When `onResult` is a worklet it is called with the worklet's result on the UI
+ * runtime, otherwise it is called on the JS thread. Shared values captured by
+ * the worklet are copied to the background runtime, not shared with it, see
+ * `startBackgroundRuntimes` for the ones used on the UI thread.
+ * Background runtimes are started with the default size if
+ * `startBackgroundRuntimes` wasn't called before.
+ */
+export function runOnBackground<A extends any[], R>(
+  worklet: ComplexWorkletFunction<A, R>,
+  onResult?: (result: R) => void
+): (...args: A) => void {
+  if (__DEV__ && IS_NATIVE && _WORKLET) {
+    throw new Error(
+      '[Reanimated] `runOnBackground` can only be called on the JS thread.'
+    );
+  }
+  if (__DEV__ && IS_NATIVE && worklet.__workletHash === undefined) {
+    throw new Error(
+      '[Reanimated] `runOnBackground` can only be used on worklets.'
+    );
+  }
+  if (!IS_NATIVE) {
+    return (...args) =>
+      queueMicrotask(() => {
+        const result = worklet(...args);
+        onResult?.(result);
+      });
+  }
+  startBackgroundRuntimes();
+  const shareableOnResult =
+    onResult === undefined ? undefined : makeShareableCloneRecursive(onResult);
+  return (...args) => {
+    NativeReanimatedModule.scheduleOnBackground(
+      makeShareableCloneRecursive(() => {
+        'worklet';
+        return makeShareableCloneOnUIRecursive(worklet(...args));
+      }),
+      shareableOnResult
     );
   };
 }
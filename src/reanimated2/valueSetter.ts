@@ -1,11 +1,42 @@
 import type { AnimationObject, AnimatableValue } from './commonTypes';
 import type { Descriptor } from './hook/commonTypes';
+import { shouldBeUseWeb } from './PlatformChecker';
+
+const IS_NATIVE = !shouldBeUseWeb();
+
+// Hands a running animation of a number over to the native animation driver,
+// which steps it without calling into JS on every frame.
+function runOnNativeDriver(sv: any, animation: AnimationObject): boolean {
+  'worklet';
+  if (
+    !IS_NATIVE ||
+    animation.cancelled ||
+    typeof animation.current !== 'number' ||
+    !animation.toNativeConfig
+  ) {
+    return false;
+  }
+  const config = animation.toNativeConfig(animation);
+  if (!config) {
+    return false;
+  }
+  animation.__nativeAnimationId = global._startNativeAnimation(
+    sv,
+    animation,
+    config
+  );
+  return true;
+}
 
 export function valueSetter(sv: any, value: any): void {
   'worklet';
   const previousAnimation = sv._animation;
   if (previousAnimation) {
     previousAnimation.cancelled = true;
+    if (previousAnimation.__nativeAnimationId !== undefined) {
+      // writes the state of the animation back to `previousAnimation`
+      global._stopNativeAnimation(previousAnimation.__nativeAnimationId);
+    }
     sv._animation = null;
   }
   if (
@@ -43,7 +74,7 @@ export function valueSetter(sv: any, value: any): void {
       sv._value = animation.current;
       if (finished) {
         animation.callback && animation.callback(true /* finished */);
-      } else {
+      } else if (!runOnNativeDriver(sv, animation)) {
         requestAnimationFrame(step);
       }
     };